@@ -0,0 +1,141 @@
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "../../../Graph Store/Graph Store/File Parser/FileParser.h"
+#include "../../../Graph Store/Graph Store/Mapped File Parser/MappedFileParser.h"
+
+static const size_t RUNS_COUNT = 3;
+
+static void writeRandomGraphFile(const char* fileName, unsigned verticesCount, unsigned edgesCount)
+{
+	std::mt19937 generator(13);
+	std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+
+	file << "benchmark\ndirected\n" << verticesCount << '\n';
+
+	for (unsigned i = 0; i < verticesCount; ++i)
+	{
+		file << "vertex" << i << '\n';
+	}
+
+	file << edgesCount << '\n';
+
+	for (unsigned i = 0; i < edgesCount; ++i)
+	{
+		file << '(' << generator() % verticesCount
+			 << ", " << generator() % verticesCount
+			 << ", " << generator() % 1000 << ")\n";
+	}
+}
+
+static size_t lengthOf(const String& line)
+{
+	return line.getLength();
+}
+
+static size_t lengthOf(const MappedFileParser::Token& line)
+{
+	return line.getLength();
+}
+
+template <class Parser>
+static unsigned parseUnsignedAndSkipUntil(Parser& parser, char symbol)
+{
+	unsigned result = parser.parseUnsigned();
+	parser.skipUntil(symbol);
+
+	return result;
+}
+
+///
+/// Parses the file the way GraphBuilder does and sums up what it read, so
+/// that both parsers can be checked to read the same.
+///
+template <class Parser>
+static size_t parse(const char* fileName)
+{
+	Parser parser(fileName);
+	size_t checksum = lengthOf(parser.readLine()) + lengthOf(parser.readLine());
+
+	unsigned verticesCount = parseUnsignedAndSkipUntil(parser, '\n');
+
+	for (unsigned i = 0; i < verticesCount; ++i)
+	{
+		checksum += lengthOf(parser.readLine());
+	}
+
+	unsigned edgesCount = parseUnsignedAndSkipUntil(parser, '\n');
+
+	for (unsigned i = 0; i < edgesCount; ++i)
+	{
+		parser.skipUntil('(');
+		checksum += parseUnsignedAndSkipUntil(parser, ',');
+		checksum += parseUnsignedAndSkipUntil(parser, ',');
+		checksum += parseUnsignedAndSkipUntil(parser, ')');
+		parser.skipUntil('\n');
+	}
+
+	return checksum;
+}
+
+template <class Parser>
+static void measure(const char* name, const char* fileName, double megabytes)
+{
+	size_t checksum = 0;
+	double bestSeconds = 0;
+
+	for (size_t i = 0; i < RUNS_COUNT; ++i)
+	{
+		auto start = std::chrono::steady_clock::now();
+		checksum = parse<Parser>(fileName);
+		auto end = std::chrono::steady_clock::now();
+
+		double seconds = std::chrono::duration<double>(end - start).count();
+
+		if (i == 0 || seconds < bestSeconds)
+		{
+			bestSeconds = seconds;
+		}
+	}
+
+	std::cout << "  " << std::left << std::setw(10) << name
+			  << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+			  << megabytes / bestSeconds << " MB/s"
+			  << std::setw(16) << checksum << " checksum\n";
+}
+
+///
+/// Parses a graph file with FileParser and with MappedFileParser and prints
+/// the best throughput of each. Without a file name a random graph file is
+/// written first. The first run of each parser warms the page cache, so the
+/// numbers compare the parsing rather than the disk.
+///
+int main(int argc, char* argv[])
+{
+	const char* fileName = (argc > 1) ? argv[1] : "benchmark.txt";
+
+	if (argc <= 1)
+	{
+		writeRandomGraphFile(fileName, 1000000, 8000000);
+	}
+
+	std::ifstream file(fileName, std::ios::in | std::ios::binary | std::ios::ate);
+
+	if (!file)
+	{
+		std::cerr << "Could not open " << fileName << '\n';
+		return 1;
+	}
+
+	double megabytes = static_cast<double>(file.tellg()) / (1024 * 1024);
+	file.close();
+
+	std::cout << fileName << ", " << std::fixed << std::setprecision(1) << megabytes << " MB:\n";
+
+	measure<FileParser>("ifstream", fileName, megabytes);
+	measure<MappedFileParser>("mapped", fileName, megabytes);
+
+	return 0;
+}
\ No newline at end of file
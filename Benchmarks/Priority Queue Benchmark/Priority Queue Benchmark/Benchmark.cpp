@@ -0,0 +1,162 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../../../Graph Store/Graph Store/Priority Queue/PriorityQueue.h"
+#include "../../../Graph Store/Graph Store/Priority Queue/Pairing Heap/PairingHeap.h"
+
+struct Edge
+{
+	unsigned end;
+	unsigned weight;
+};
+
+struct Vertex
+{
+	unsigned distance;
+	PriorityQueueHandle handle;
+	bool isInQueue;
+};
+
+class DistanceAccessor
+{
+public:
+	const unsigned& getKeyOf(const Vertex* v) const
+	{
+		return v->distance;
+	}
+
+	void setKeyOfWith(Vertex* v, unsigned distance) const
+	{
+		v->distance = distance;
+	}
+};
+
+class HandleUpdator
+{
+public:
+	void operator()(Vertex* v, const PriorityQueueHandle& handle) const
+	{
+		v->handle = handle;
+	}
+};
+
+typedef std::vector<std::vector<Edge>> Graph;
+
+template <size_t Arity>
+using DAryHeap = PriorityQueue<Vertex*, Less, unsigned, DistanceAccessor, HandleUpdator, Arity>;
+
+typedef PairingHeap<Vertex*, Less, unsigned, DistanceAccessor, HandleUpdator> Pairing;
+
+static const unsigned INFINITE_DISTANCE = static_cast<unsigned>(-1);
+static const size_t SEARCHES_COUNT = 20;
+
+static Graph createRandomGraph(size_t verticesCount, size_t degree, unsigned seed)
+{
+	std::mt19937 generator(seed);
+	Graph graph(verticesCount);
+
+	for (size_t i = 0; i < verticesCount; ++i)
+	{
+		for (size_t j = 0; j < degree; ++j)
+		{
+			graph[i].push_back({ static_cast<unsigned>(generator() % verticesCount),
+								 static_cast<unsigned>(1 + generator() % 1000) });
+		}
+	}
+
+	return graph;
+}
+
+template <class Queue>
+static size_t search(const Graph& graph, std::vector<Vertex>& vertices, unsigned source)
+{
+	for (Vertex& v : vertices)
+	{
+		v.distance = INFINITE_DISTANCE;
+		v.isInQueue = false;
+	}
+
+	Queue queue;
+	size_t optimisationsCount = 0;
+
+	vertices[source].distance = 0;
+	vertices[source].isInQueue = true;
+	queue.add(&vertices[source]);
+
+	while (!queue.isEmpty())
+	{
+		Vertex* v = queue.extractOptimal();
+		v->isInQueue = false;
+
+		for (const Edge& e : graph[v - &vertices[0]])
+		{
+			Vertex& end = vertices[e.end];
+			unsigned distanceThroughV = v->distance + e.weight;
+
+			if (distanceThroughV < end.distance)
+			{
+				if (end.isInQueue)
+				{
+					queue.optimiseKey(end.handle, distanceThroughV);
+					++optimisationsCount;
+				}
+				else if (end.distance == INFINITE_DISTANCE)
+				{
+					end.distance = distanceThroughV;
+					end.isInQueue = true;
+					queue.add(&end);
+				}
+			}
+		}
+	}
+
+	return optimisationsCount;
+}
+
+template <class Queue>
+static void measure(const char* name, const Graph& graph)
+{
+	std::vector<Vertex> vertices(graph.size());
+	size_t optimisationsCount = 0;
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (unsigned i = 0; i < SEARCHES_COUNT; ++i)
+	{
+		optimisationsCount += search<Queue>(graph, vertices, i);
+	}
+
+	auto end = std::chrono::steady_clock::now();
+	double milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+
+	std::cout << "  " << std::left << std::setw(10) << name
+			  << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+			  << milliseconds / SEARCHES_COUNT << " ms/search"
+			  << std::setw(12) << optimisationsCount / SEARCHES_COUNT << " optimisations/search\n";
+}
+
+///
+/// Runs Dijkstra's algorithm over random graphs with each of the priority
+/// queues and prints the time per search. The denser the graph, the more
+/// keys are optimised per extraction.
+///
+int main()
+{
+	const size_t sizes[][2] = { { 100000, 4 }, { 100000, 16 }, { 20000, 256 }, { 1000000, 8 } };
+
+	for (const auto& size : sizes)
+	{
+		Graph graph = createRandomGraph(size[0], size[1], 13);
+
+		std::cout << size[0] << " vertices, degree " << size[1] << ":\n";
+
+		measure<DAryHeap<2>>("binary", graph);
+		measure<DAryHeap<4>>("4-ary", graph);
+		measure<DAryHeap<8>>("8-ary", graph);
+		measure<Pairing>("pairing", graph);
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef __BUCKET_QUEUE_HEADER_INCLUDED__
+#define __BUCKET_QUEUE_HEADER_INCLUDED__
+
+#include <queue>
+#include <vector>
+
+///
+/// Dial's monotone priority queue for unsigned integer keys: a circular
+/// array of buckets, one per key, and a cursor at the lowest key which
+/// may still have items. Adding is O(1) and extracting is amortised O(1)
+/// plus the number of empty buckets the cursor passes over.
+///
+/// The keys must not be lower than the last extracted one. The buckets
+/// cover [cursor, cursor + buckets count) and their number doubles
+/// whenever a key falls outside, so it settles at the largest difference
+/// between the added keys and the cursor, i.e. the heaviest edge in
+/// Dijkstra's algorithm. It is capped at MAX_BUCKETS_COUNT, so a single
+/// heavy edge does not allocate a bucket per unit of its weight: the keys
+/// beyond the buckets wait in a binary heap and are moved into the buckets
+/// once the cursor reaches the lowest of them.
+///
+/// There is no decrease-key: an item is added again with its lower key
+/// and the stale entry is skipped by the caller when extracted.
+///
+template <class Item>
+class BucketQueue
+{
+	typedef std::vector<Item> Bucket;
+
+	struct OverflowItem
+	{
+		Item item;
+		unsigned key;
+	};
+
+	struct HasGreaterKey
+	{
+		bool operator()(const OverflowItem& lhs, const OverflowItem& rhs) const
+		{
+			return lhs.key > rhs.key;
+		}
+	};
+
+	typedef std::priority_queue<OverflowItem, std::vector<OverflowItem>, HasGreaterKey> OverflowHeap;
+
+public:
+	BucketQueue();
+	BucketQueue(const BucketQueue<Item>&) = default;
+	BucketQueue<Item>& operator=(const BucketQueue<Item>&) = default;
+	~BucketQueue() = default;
+
+	void add(const Item& item, unsigned key);
+	Item extractOptimal();
+	unsigned getOptimalKey();
+	void empty();
+	bool isEmpty() const;
+
+private:
+	static const size_t INITIAL_BUCKETS_COUNT = 16;
+	static const size_t MAX_BUCKETS_COUNT = 1 << 16;
+
+private:
+	bool isCoveredByBuckets(unsigned key) const;
+	void growToCover(unsigned key);
+	void advanceToNonEmptyBucket();
+	void moveOverflowItemsReachedByCursor();
+	Bucket& getBucketOf(unsigned key);
+	void verifyKeyIsNotBelowCursor(unsigned key) const;
+	void verifyQueueIsNotEmpty() const;
+
+private:
+	std::vector<Bucket> buckets;
+	OverflowHeap overflowItems;
+	size_t itemsCount;
+	unsigned cursor;
+};
+
+#include "BucketQueue.hpp"
+
+#endif //__BUCKET_QUEUE_HEADER_INCLUDED__
\ No newline at end of file
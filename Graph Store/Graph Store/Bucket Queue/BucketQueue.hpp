@@ -0,0 +1,176 @@
+#include <stdexcept>
+#include <utility>
+
+template <class Item>
+BucketQueue<Item>::BucketQueue() :
+	buckets(INITIAL_BUCKETS_COUNT),
+	itemsCount(0),
+	cursor(0)
+{
+}
+
+///
+/// A key too far from the cursor for MAX_BUCKETS_COUNT buckets waits in
+/// the overflow heap.
+///
+template <class Item>
+void BucketQueue<Item>::add(const Item& item, unsigned key)
+{
+	verifyKeyIsNotBelowCursor(key);
+
+	if (!isCoveredByBuckets(key) && buckets.size() < MAX_BUCKETS_COUNT)
+	{
+		growToCover(key);
+	}
+
+	if (isCoveredByBuckets(key))
+	{
+		getBucketOf(key).push_back(item);
+		++itemsCount;
+	}
+	else
+	{
+		overflowItems.push(OverflowItem{ item, key });
+	}
+}
+
+template <class Item>
+inline bool BucketQueue<Item>::isCoveredByBuckets(unsigned key) const
+{
+	return key - cursor < buckets.size();
+}
+
+template <class Item>
+inline void BucketQueue<Item>::verifyKeyIsNotBelowCursor(unsigned key) const
+{
+	if (key < cursor)
+	{
+		throw std::invalid_argument("The key is lower than the last extracted one!");
+	}
+}
+
+///
+/// A bucket only ever holds the items of one key, the one in
+/// [cursor, cursor + buckets count) which maps to it, so the items of the
+/// old buckets are moved by those keys.
+///
+template <class Item>
+void BucketQueue<Item>::growToCover(unsigned key)
+{
+	size_t newBucketsCount = buckets.size();
+
+	while (key - cursor >= newBucketsCount && newBucketsCount < MAX_BUCKETS_COUNT)
+	{
+		newBucketsCount *= 2;
+	}
+
+	std::vector<Bucket> oldBuckets(newBucketsCount);
+	std::swap(buckets, oldBuckets);
+
+	for (size_t i = 0; i < oldBuckets.size(); ++i)
+	{
+		unsigned keyOfBucket = cursor + static_cast<unsigned>((i - cursor) & (oldBuckets.size() - 1));
+
+		std::swap(getBucketOf(keyOfBucket), oldBuckets[i]);
+	}
+}
+
+template <class Item>
+inline typename BucketQueue<Item>::Bucket& BucketQueue<Item>::getBucketOf(unsigned key)
+{
+	return buckets[key & (buckets.size() - 1)];
+}
+
+template <class Item>
+Item BucketQueue<Item>::extractOptimal()
+{
+	advanceToNonEmptyBucket();
+
+	Bucket& bucket = getBucketOf(cursor);
+	Item optimal = bucket.back();
+	bucket.pop_back();
+	--itemsCount;
+
+	return optimal;
+}
+
+template <class Item>
+unsigned BucketQueue<Item>::getOptimalKey()
+{
+	advanceToNonEmptyBucket();
+
+	return cursor;
+}
+
+///
+/// When the buckets are empty, the cursor jumps straight to the lowest
+/// overflow key instead of passing over the empty buckets up to it.
+///
+template <class Item>
+void BucketQueue<Item>::advanceToNonEmptyBucket()
+{
+	verifyQueueIsNotEmpty();
+
+	if (itemsCount == 0)
+	{
+		cursor = overflowItems.top().key;
+	}
+
+	moveOverflowItemsReachedByCursor();
+
+	while (getBucketOf(cursor).empty())
+	{
+		++cursor;
+		moveOverflowItemsReachedByCursor();
+	}
+}
+
+///
+/// The overflow items are moved only once the cursor reaches the lowest of
+/// them, and then all of those which the buckets cover are moved at once.
+///
+template <class Item>
+void BucketQueue<Item>::moveOverflowItemsReachedByCursor()
+{
+	if (overflowItems.empty() || overflowItems.top().key != cursor)
+	{
+		return;
+	}
+
+	while (!overflowItems.empty() && isCoveredByBuckets(overflowItems.top().key))
+	{
+		const OverflowItem& overflowItem = overflowItems.top();
+
+		getBucketOf(overflowItem.key).push_back(overflowItem.item);
+		++itemsCount;
+		overflowItems.pop();
+	}
+}
+
+template <class Item>
+inline void BucketQueue<Item>::verifyQueueIsNotEmpty() const
+{
+	if (isEmpty())
+	{
+		throw std::logic_error("The queue is empty!");
+	}
+}
+
+template <class Item>
+void BucketQueue<Item>::empty()
+{
+	for (Bucket& bucket : buckets)
+	{
+		bucket.clear();
+	}
+
+	overflowItems = OverflowHeap();
+	itemsCount = 0;
+	cursor = 0;
+}
+
+template <class Item>
+inline bool BucketQueue<Item>::isEmpty() const
+{
+	return itemsCount == 0 && overflowItems.empty();
+}
\ No newline at end of file
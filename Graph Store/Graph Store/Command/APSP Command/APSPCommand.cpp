@@ -0,0 +1,67 @@
+#include "APSPCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Shortest Path Algorithms/All Pairs Shortest Paths/AllPairsShortestPaths.h"
+#include <string>
+
+static CommandRegistrator<APSPCommand> registrator("APSP",
+												   "Computes the shortest paths between all pairs of vertices of a graph of at most 8192 vertices for SEARCH to look up");
+
+const size_t APSPCommand::MAX_VERTICES_COUNT;
+
+void APSPCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	computeAllPairsShortestPaths(graphID);
+}
+
+void APSPCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> id(parser, "graph id", "The identifier of the graph");
+
+	parser.Parse();
+
+	setGraphID(id);
+}
+
+void APSPCommand::setGraphID(args::Positional<String, StringReader>& id)
+{
+	if (id.Matched())
+	{
+		graphID = args::get(id);
+	}
+	else
+	{
+		throw MissingArgumentException(id.Name());
+	}
+}
+
+void APSPCommand::computeAllPairsShortestPaths(const String& graphID)
+{
+	Graph& graph = getGraphs().getGraphWithID(graphID);
+
+	verifyIsSmallEnough(graph);
+
+	try
+	{
+		graph.setAllPairsShortestPaths(std::unique_ptr<AllPairsShortestPaths>(new AllPairsShortestPaths(graph)));
+	}
+	catch (std::bad_alloc&)
+	{
+		throw CommandException(String("Not enough memory for the all pairs shortest paths!"));
+	}
+}
+
+///
+/// The matrices take 8 bytes per pair of vertices and computing them takes
+/// time cubic in the number of vertices: half a gigabyte and minutes at the
+/// limit, which grows eightfold in time with each doubling.
+///
+void APSPCommand::verifyIsSmallEnough(const Graph& graph)
+{
+	if (graph.getVerticesCount() > MAX_VERTICES_COUNT)
+	{
+		throw CommandException("The graph has too many vertices for all pairs shortest paths, at most "
+							   + std::to_string(MAX_VERTICES_COUNT) + " are allowed!");
+	}
+}
\ No newline at end of file
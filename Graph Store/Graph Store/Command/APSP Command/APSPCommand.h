@@ -0,0 +1,34 @@
+#ifndef __APSP_COMMAND_HEADER_INCLUDED__
+#define __APSP_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+
+class APSPCommand : public Command
+{
+public:
+	APSPCommand() = default;
+	APSPCommand(const APSPCommand&) = delete;
+	APSPCommand& operator=(const APSPCommand&) = delete;
+	APSPCommand(APSPCommand&&) = delete;
+	APSPCommand& operator=(APSPCommand&&) = delete;
+	virtual ~APSPCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static const size_t MAX_VERTICES_COUNT = 8192;
+
+private:
+	static void computeAllPairsShortestPaths(const String& graphID);
+	static void verifyIsSmallEnough(const Graph& graph);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setGraphID(args::Positional<String, StringReader>& id);
+
+private:
+	String graphID;
+};
+
+#endif //__APSP_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include "ConfigureBFSCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../../Shortest Path Algorithms/Store/ShortestPathAlgorithmsStore.h"
+#include "../../Shortest Path Algorithms/BFS/BFSShortestPath.h"
+
+static CommandRegistrator<ConfigureBFSCommand> registrator("CONFIGURE-BFS",
+														   "Sets the number of threads of the bfs algorithm");
+
+void ConfigureBFSCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	configureBFS(threadsCount);
+}
+
+void ConfigureBFSCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<unsigned> threadsCount(parser, "threads count", "The number of threads to use, all hardware threads if 0 or omitted");
+
+	parser.Parse();
+
+	setThreadsCount(threadsCount);
+}
+
+void ConfigureBFSCommand::setThreadsCount(args::Positional<unsigned>& threadsCount)
+{
+	this->threadsCount = threadsCount.Matched() ? args::get(threadsCount) : 0;
+}
+
+void ConfigureBFSCommand::configureBFS(unsigned threadsCount)
+{
+	BFSShortestPath& algorithm = dynamic_cast<BFSShortestPath&>(
+		ShortestPathAlgorithmsStore::instance().searchForAlgorithm(String("bfs")));
+
+	algorithm.setThreadsCount(threadsCount);
+}
\ No newline at end of file
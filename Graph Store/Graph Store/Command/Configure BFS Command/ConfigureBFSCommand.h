@@ -0,0 +1,29 @@
+#ifndef __CONFIGURE_BFS_COMMAND_HEADER_INCLUDED__
+#define __CONFIGURE_BFS_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+
+class ConfigureBFSCommand : public Command
+{
+public:
+	ConfigureBFSCommand() = default;
+	ConfigureBFSCommand(const ConfigureBFSCommand&) = delete;
+	ConfigureBFSCommand& operator=(const ConfigureBFSCommand&) = delete;
+	ConfigureBFSCommand(ConfigureBFSCommand&&) = delete;
+	ConfigureBFSCommand& operator=(ConfigureBFSCommand&&) = delete;
+	virtual ~ConfigureBFSCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void configureBFS(unsigned threadsCount);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setThreadsCount(args::Positional<unsigned>& threadsCount);
+
+private:
+	unsigned threadsCount;
+};
+
+#endif //__CONFIGURE_BFS_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "ConfigureDeltaSteppingCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Shortest Path Algorithms/Store/ShortestPathAlgorithmsStore.h"
+#include "../../Shortest Path Algorithms/Delta Stepping/DeltaSteppingShortestPath.h"
+
+static CommandRegistrator<ConfigureDeltaSteppingCommand> registrator("CONFIGURE-DELTA-STEPPING",
+																	 "Sets the bucket width and the number of threads of the delta-stepping algorithm");
+
+void ConfigureDeltaSteppingCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	configureDeltaStepping(delta, threadsCount);
+}
+
+void ConfigureDeltaSteppingCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<unsigned> delta(parser, "delta", "The width of a bucket");
+	args::Positional<unsigned> threadsCount(parser, "threads count", "The number of threads to use, all hardware threads if 0 or omitted");
+
+	parser.Parse();
+
+	setDelta(delta);
+	setThreadsCount(threadsCount);
+}
+
+void ConfigureDeltaSteppingCommand::setDelta(args::Positional<unsigned>& delta)
+{
+	if (!delta.Matched())
+	{
+		throw MissingArgumentException(delta.Name());
+	}
+	else if (args::get(delta) == 0)
+	{
+		throw CommandException(String("The width of a bucket must be positive!"));
+	}
+
+	this->delta = args::get(delta);
+}
+
+void ConfigureDeltaSteppingCommand::setThreadsCount(args::Positional<unsigned>& threadsCount)
+{
+	this->threadsCount = threadsCount.Matched() ? args::get(threadsCount) : 0;
+}
+
+void ConfigureDeltaSteppingCommand::configureDeltaStepping(unsigned delta, unsigned threadsCount)
+{
+	DeltaSteppingShortestPath& algorithm = dynamic_cast<DeltaSteppingShortestPath&>(
+		ShortestPathAlgorithmsStore::instance().searchForAlgorithm(String("delta-stepping")));
+
+	algorithm.setDelta(delta);
+	algorithm.setThreadsCount(threadsCount);
+}
\ No newline at end of file
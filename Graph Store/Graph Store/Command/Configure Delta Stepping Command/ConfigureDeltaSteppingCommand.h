@@ -0,0 +1,31 @@
+#ifndef __CONFIGURE_DELTA_STEPPING_COMMAND_HEADER_INCLUDED__
+#define __CONFIGURE_DELTA_STEPPING_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+
+class ConfigureDeltaSteppingCommand : public Command
+{
+public:
+	ConfigureDeltaSteppingCommand() = default;
+	ConfigureDeltaSteppingCommand(const ConfigureDeltaSteppingCommand&) = delete;
+	ConfigureDeltaSteppingCommand& operator=(const ConfigureDeltaSteppingCommand&) = delete;
+	ConfigureDeltaSteppingCommand(ConfigureDeltaSteppingCommand&&) = delete;
+	ConfigureDeltaSteppingCommand& operator=(ConfigureDeltaSteppingCommand&&) = delete;
+	virtual ~ConfigureDeltaSteppingCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void configureDeltaStepping(unsigned delta, unsigned threadsCount);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setDelta(args::Positional<unsigned>& delta);
+	void setThreadsCount(args::Positional<unsigned>& threadsCount);
+
+private:
+	unsigned delta;
+	unsigned threadsCount;
+};
+
+#endif //__CONFIGURE_DELTA_STEPPING_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
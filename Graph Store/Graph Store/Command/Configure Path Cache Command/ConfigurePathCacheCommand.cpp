@@ -0,0 +1,39 @@
+#include "ConfigurePathCacheCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Shortest Path Algorithms/Path Cache/PathCache.h"
+
+static CommandRegistrator<ConfigurePathCacheCommand> registrator("CONFIGURE-PATH-CACHE",
+																 "Sets the memory the cache of the paths found by SEARCH may take");
+
+void ConfigurePathCacheCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	configurePathCache(memoryLimit);
+}
+
+void ConfigurePathCacheCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<unsigned> memoryLimit(parser, "memory limit", "The memory in kilobytes, 0 turns the cache off");
+
+	parser.Parse();
+
+	setMemoryLimit(memoryLimit);
+}
+
+void ConfigurePathCacheCommand::setMemoryLimit(args::Positional<unsigned>& memoryLimit)
+{
+	if (memoryLimit.Matched())
+	{
+		this->memoryLimit = args::get(memoryLimit);
+	}
+	else
+	{
+		throw MissingArgumentException(memoryLimit.Name());
+	}
+}
+
+void ConfigurePathCacheCommand::configurePathCache(unsigned memoryLimit)
+{
+	PathCache::instance().setMemoryLimit(static_cast<size_t>(memoryLimit) * 1024);
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#ifndef __CONFIGURE_PATH_CACHE_COMMAND_HEADER_INCLUDED__
+#define __CONFIGURE_PATH_CACHE_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+
+class ConfigurePathCacheCommand : public Command
+{
+public:
+	ConfigurePathCacheCommand() = default;
+	ConfigurePathCacheCommand(const ConfigurePathCacheCommand&) = delete;
+	ConfigurePathCacheCommand& operator=(const ConfigurePathCacheCommand&) = delete;
+	ConfigurePathCacheCommand(ConfigurePathCacheCommand&&) = delete;
+	ConfigurePathCacheCommand& operator=(ConfigurePathCacheCommand&&) = delete;
+	virtual ~ConfigurePathCacheCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void configurePathCache(unsigned memoryLimit);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setMemoryLimit(args::Positional<unsigned>& memoryLimit);
+
+private:
+	unsigned memoryLimit;
+};
+
+#endif //__CONFIGURE_PATH_CACHE_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "DistanceMatrixCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../File Parser/FileParser.h"
+#include "../../Thread Pool/ThreadPool.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+static CommandRegistrator<DistanceMatrixCommand> registrator("DISTANCE-MATRIX",
+															 "Writes the distances from the vertices listed in one file to those listed in another");
+
+void DistanceMatrixCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	computeDistanceMatrix(sourcesFileName, targetsFileName, outputFileName, threadsCount, isBinary);
+}
+
+void DistanceMatrixCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> sourcesFileName(parser, "sources file", "A file with the identifier of a source on each line");
+	args::Positional<String, StringReader> targetsFileName(parser, "targets file", "A file with the identifier of a target on each line");
+	args::Positional<String, StringReader> outputFileName(parser, "output file", "The file to write the matrix to");
+	args::Positional<unsigned> threadsCount(parser, "threads count", "The number of threads to use, at most 4 per hardware thread, all hardware threads if 0 or omitted");
+	args::Flag binary(parser, "binary", "Write the matrix in binary instead of CSV", { "binary" });
+
+	parser.Parse();
+
+	setFileName(sourcesFileName, this->sourcesFileName);
+	setFileName(targetsFileName, this->targetsFileName);
+	setFileName(outputFileName, this->outputFileName);
+	setThreadsCount(threadsCount);
+	isBinary = binary.Matched();
+}
+
+void DistanceMatrixCommand::setFileName(args::Positional<String, StringReader>& name, String& fileName)
+{
+	if (name.Matched())
+	{
+		fileName = args::get(name);
+	}
+	else
+	{
+		throw MissingArgumentException(name.Name());
+	}
+}
+
+void DistanceMatrixCommand::setThreadsCount(args::Positional<unsigned>& threadsCount)
+{
+	this->threadsCount = threadsCount.Matched() ? args::get(threadsCount) : 0;
+
+	if (this->threadsCount > ThreadPool::getMaxThreadsCount())
+	{
+		throw CommandException("The number of threads must be at most "
+							   + std::to_string(ThreadPool::getMaxThreadsCount()) + "!");
+	}
+}
+
+///
+/// The output file is opened before computing, so a bad name is reported
+/// without any work done.
+///
+void DistanceMatrixCommand::computeDistanceMatrix(const String& sourcesFileName,
+												  const String& targetsFileName,
+												  const String& outputFileName,
+												  unsigned threadsCount,
+												  bool isBinary)
+{
+	Graph& usedGraph = getUsedGraph();
+	DistanceMatrix matrix(readVertices(usedGraph, sourcesFileName),
+						  readVertices(usedGraph, targetsFileName));
+
+	std::ofstream file(outputFileName.cString(), isBinary ? std::ios::out | std::ios::binary : std::ios::out);
+
+	if (!file)
+	{
+		throw CommandException("Could not open file for writing, name: " + outputFileName);
+	}
+
+	matrix.compute(usedGraph,
+				   (threadsCount > 0) ? threadsCount : ThreadPool::getDefaultThreadsCount(),
+				   createProgressReporter(matrix.getRowsCount(), matrix.getColumnsCount()));
+
+	if (isBinary)
+	{
+		matrix.writeAsBinary(file);
+	}
+	else
+	{
+		matrix.writeAsCSV(file);
+	}
+
+	if (!file)
+	{
+		throw CommandException("Could not write the matrix to file, name: " + outputFileName);
+	}
+}
+
+///
+/// Empty lines are skipped.
+///
+DistanceMatrix::VerticesArray DistanceMatrixCommand::readVertices(Graph& graph, const String& fileName)
+{
+	FileParser parser(fileName);
+	DistanceMatrix::VerticesArray vertices;
+
+	while (!parser.hasReachedEnd() && parser.peek() != FileParser::endOfFileCharacter())
+	{
+		String id = parser.readLine();
+
+		if (id != String(""))
+		{
+			vertices.push_back(&graph.getVertexWithID(id));
+		}
+	}
+
+	return vertices;
+}
+
+///
+/// Reports the rows computed so far with the searches and the distances
+/// per second, at most once a second and once more at the end.
+///
+DistanceMatrix::ProgressListener DistanceMatrixCommand::createProgressReporter(size_t rowsCount, size_t columnsCount)
+{
+	typedef std::chrono::steady_clock Clock;
+
+	Clock::time_point start = Clock::now();
+	Clock::time_point lastReport = start;
+
+	return [=](size_t computedRowsCount) mutable
+	{
+		Clock::time_point now = Clock::now();
+
+		if (computedRowsCount < rowsCount && now - lastReport < std::chrono::seconds(1))
+		{
+			return;
+		}
+
+		double seconds = std::chrono::duration<double>(now - start).count();
+		double searchesPerSecond = (seconds > 0) ? computedRowsCount / seconds : 0;
+
+		std::cout << "Computed " << computedRowsCount << " of " << rowsCount << " rows, "
+				  << searchesPerSecond << " searches/s, "
+				  << searchesPerSecond * columnsCount << " distances/s.\n";
+
+		lastReport = now;
+	};
+}
\ No newline at end of file
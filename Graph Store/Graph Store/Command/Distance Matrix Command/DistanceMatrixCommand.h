@@ -0,0 +1,42 @@
+#ifndef __DISTANCE_MATRIX_COMMAND_HEADER_INCLUDED__
+#define __DISTANCE_MATRIX_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+#include "../../Shortest Path Algorithms/Distance Matrix/DistanceMatrix.h"
+
+class DistanceMatrixCommand : public Command
+{
+public:
+	DistanceMatrixCommand() = default;
+	DistanceMatrixCommand(const DistanceMatrixCommand&) = delete;
+	DistanceMatrixCommand& operator=(const DistanceMatrixCommand&) = delete;
+	DistanceMatrixCommand(DistanceMatrixCommand&&) = delete;
+	DistanceMatrixCommand& operator=(DistanceMatrixCommand&&) = delete;
+	virtual ~DistanceMatrixCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void computeDistanceMatrix(const String& sourcesFileName,
+									  const String& targetsFileName,
+									  const String& outputFileName,
+									  unsigned threadsCount,
+									  bool isBinary);
+	static DistanceMatrix::VerticesArray readVertices(Graph& graph, const String& fileName);
+	static DistanceMatrix::ProgressListener createProgressReporter(size_t rowsCount, size_t columnsCount);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setFileName(args::Positional<String, StringReader>& name, String& fileName);
+	void setThreadsCount(args::Positional<unsigned>& threadsCount);
+
+private:
+	String sourcesFileName;
+	String targetsFileName;
+	String outputFileName;
+	unsigned threadsCount;
+	bool isBinary;
+};
+
+#endif //__DISTANCE_MATRIX_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "FreezeCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Graph/Static Graph/StaticGraph.h"
+
+static CommandRegistrator<FreezeCommand> registrator("FREEZE",
+													 "Converts a specified graph into an immutable one, optimised for searching");
+
+void FreezeCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	freezeGraph(graphID);
+}
+
+void FreezeCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> id(parser, "graph id", "The identifier of the graph to freeze");
+	parser.Parse();
+	setGraphID(id);
+}
+
+void FreezeCommand::setGraphID(args::Positional<String, StringReader>& id)
+{
+	if (id.Matched())
+	{
+		graphID = args::get(id);
+	}
+	else
+	{
+		throw MissingArgumentException(id.Name());
+	}
+}
+
+void FreezeCommand::freezeGraph(const String& id)
+{
+	GraphCollection& graphs = getGraphs();
+	Graph& graph = graphs.getGraphWithID(id);
+
+	verifyIsNotFrozen(graph);
+
+	std::unique_ptr<Graph> frozenGraph = StaticGraph::createFrozenCopyOf(graph);
+	std::unique_ptr<Graph> replacedGraph = graphs.replace(*frozenGraph);
+
+	if (isUsedGraph(*replacedGraph))
+	{
+		setUsedGraph(*frozenGraph);
+	}
+
+	frozenGraph.release();
+}
+
+void FreezeCommand::verifyIsNotFrozen(const Graph& graph)
+{
+	if (dynamic_cast<const StaticGraph*>(&graph) != nullptr)
+	{
+		throw CommandException("The graph is already frozen: " + graph.getID());
+	}
+}
\ No newline at end of file
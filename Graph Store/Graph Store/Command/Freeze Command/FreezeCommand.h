@@ -0,0 +1,31 @@
+#ifndef __FREEZE_COMMAND_HEADER_INCLUDED__
+#define __FREEZE_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+
+class FreezeCommand : public Command
+{
+public:
+	FreezeCommand() = default;
+	FreezeCommand(const FreezeCommand&) = delete;
+	FreezeCommand& operator=(const FreezeCommand&) = delete;
+	FreezeCommand(FreezeCommand&&) = delete;
+	FreezeCommand& operator=(FreezeCommand&&) = delete;
+	virtual ~FreezeCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void freezeGraph(const String& id);
+	static void verifyIsNotFrozen(const Graph& graph);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setGraphID(args::Positional<String, StringReader>& id);
+
+private:
+	String graphID;
+};
+
+#endif //__FREEZE_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
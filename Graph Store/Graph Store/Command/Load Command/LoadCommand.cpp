@@ -3,20 +3,31 @@
 #include "../../Directory Loader/DirectoryLoader.h"
 #include "../Command Registrator/CommandRegistrator.h"
 #include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Thread Pool/ThreadPool.h"
 
 static CommandRegistrator<LoadCommand> registrator("LOAD", "Loads files in a specified directory");
 
 void LoadCommand::execute(args::Subparser& parser)
 {
 	parseArguments(parser);
-	loadGraphs(path);
+	loadGraphs(path, pattern, isRecursive, threadsCount, maxGraphsInFlight);
 }
 
 void LoadCommand::parseArguments(args::Subparser& parser)
 {
 	args::Positional<String, StringReader> path(parser, "path", "Path to the directory to load");
+	args::Positional<unsigned> threadsCount(parser, "threads count", "The number of threads to use, all hardware threads if 0 or omitted");
+	args::Positional<unsigned> maxGraphsInFlight(parser, "graphs in flight", "The most graphs to hold in memory before adding them, twice the threads if 0 or omitted");
+	args::ValueFlag<String, StringReader> pattern(parser, "pattern", "Load the files whose names match the pattern, *.txt if omitted", { "pattern" });
+	args::Flag recursive(parser, "recursive", "Load the files in the subdirectories too", { "recursive" });
+
 	parser.Parse();
+
 	setPath(path);
+	setThreadsCount(threadsCount);
+	setMaxGraphsInFlight(maxGraphsInFlight);
+	setPattern(pattern);
+	isRecursive = recursive.Matched();
 }
 
 void LoadCommand::setPath(args::Positional<String, StringReader>& path)
@@ -31,11 +42,37 @@ void LoadCommand::setPath(args::Positional<String, StringReader>& path)
 	}
 }
 
-void LoadCommand::loadGraphs(const String& path)
+void LoadCommand::setThreadsCount(args::Positional<unsigned>& threadsCount)
+{
+	this->threadsCount = threadsCount.Matched() ? args::get(threadsCount) : 0;
+}
+
+void LoadCommand::setMaxGraphsInFlight(args::Positional<unsigned>& maxGraphsInFlight)
+{
+	this->maxGraphsInFlight = maxGraphsInFlight.Matched() ? args::get(maxGraphsInFlight) : 0;
+}
+
+void LoadCommand::setPattern(args::ValueFlag<String, StringReader>& pattern)
+{
+	this->pattern = pattern.Matched() ? args::get(pattern) : DirectoryFilesIterator::DEFAULT_PATTERN;
+}
+
+///
+/// The graphs are added in the order of their files in the directory
+/// whatever the number of threads, so which of two graphs with the same
+/// identifier is added does not change from one load to another.
+///
+void LoadCommand::loadGraphs(const String& path,
+							 const String& pattern,
+							 bool isRecursive,
+							 unsigned threadsCount,
+							 unsigned maxGraphsInFlight)
 {
-	DirectoryLoader loader;
+	size_t usedThreadsCount = (threadsCount > 0) ? threadsCount : ThreadPool::getDefaultThreadsCount();
+	DirectoryLoader loader(usedThreadsCount,
+						   (maxGraphsInFlight > 0) ? maxGraphsInFlight : 2 * usedThreadsCount);
 
-	loader.loadApplyingFunctionToEachGraph(path, tryToAddGraph);
+	loader.loadApplyingFunctionToEachGraph(path, tryToAddGraph, pattern, isRecursive);
 }
 
 void LoadCommand::tryToAddGraph(std::unique_ptr<Graph> graph)
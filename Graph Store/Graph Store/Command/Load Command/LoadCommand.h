@@ -18,15 +18,26 @@ public:
 	virtual void execute(args::Subparser& parser) override;
 
 private:
-	static void loadGraphs(const String& path);
+	static void loadGraphs(const String& path,
+						   const String& pattern,
+						   bool isRecursive,
+						   unsigned threadsCount,
+						   unsigned maxGraphsInFlight);
 	static void tryToAddGraph(std::unique_ptr<Graph> graph);
 
 private:
 	void parseArguments(args::Subparser& parser);
 	void setPath(args::Positional<String, StringReader>& path);
+	void setThreadsCount(args::Positional<unsigned>& threadsCount);
+	void setMaxGraphsInFlight(args::Positional<unsigned>& maxGraphsInFlight);
+	void setPattern(args::ValueFlag<String, StringReader>& pattern);
 
 private:
 	String path;
+	String pattern;
+	bool isRecursive;
+	unsigned threadsCount;
+	unsigned maxGraphsInFlight;
 };
 
 #endif //__LOAD_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
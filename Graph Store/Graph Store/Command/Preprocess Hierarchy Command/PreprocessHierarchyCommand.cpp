@@ -0,0 +1,64 @@
+#include "PreprocessHierarchyCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Graph/Static Graph/StaticGraph.h"
+#include "../../Shortest Path Algorithms/Contraction Hierarchy/ContractionHierarchy.h"
+
+static CommandRegistrator<PreprocessHierarchyCommand> registrator("PREPROCESS-HIERARCHY",
+																  "Builds a contraction hierarchy of a frozen graph for the ch algorithm");
+
+void PreprocessHierarchyCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	preprocessHierarchy(graphID);
+}
+
+void PreprocessHierarchyCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> id(parser, "graph id", "The identifier of the graph");
+
+	parser.Parse();
+
+	setGraphID(id);
+}
+
+void PreprocessHierarchyCommand::setGraphID(args::Positional<String, StringReader>& id)
+{
+	if (id.Matched())
+	{
+		graphID = args::get(id);
+	}
+	else
+	{
+		throw MissingArgumentException(id.Name());
+	}
+}
+
+void PreprocessHierarchyCommand::preprocessHierarchy(const String& graphID)
+{
+	StaticGraph& graph = getFrozenGraph(getGraphs().getGraphWithID(graphID));
+
+	try
+	{
+		graph.setContractionHierarchy(std::unique_ptr<ContractionHierarchy>(new ContractionHierarchy(graph)));
+	}
+	catch (std::bad_alloc&)
+	{
+		throw CommandException(String("Not enough memory for the contraction hierarchy!"));
+	}
+}
+
+///
+/// The hierarchy is only valid as long as the graph does not change.
+///
+StaticGraph& PreprocessHierarchyCommand::getFrozenGraph(Graph& graph)
+{
+	StaticGraph* frozenGraph = dynamic_cast<StaticGraph*>(&graph);
+
+	if (frozenGraph == nullptr)
+	{
+		throw CommandException("Only frozen graphs can be contracted: " + graph.getID());
+	}
+
+	return *frozenGraph;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef __PREPROCESS_HIERARCHY_COMMAND_HEADER_INCLUDED__
+#define __PREPROCESS_HIERARCHY_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+
+class StaticGraph;
+
+class PreprocessHierarchyCommand : public Command
+{
+public:
+	PreprocessHierarchyCommand() = default;
+	PreprocessHierarchyCommand(const PreprocessHierarchyCommand&) = delete;
+	PreprocessHierarchyCommand& operator=(const PreprocessHierarchyCommand&) = delete;
+	PreprocessHierarchyCommand(PreprocessHierarchyCommand&&) = delete;
+	PreprocessHierarchyCommand& operator=(PreprocessHierarchyCommand&&) = delete;
+	virtual ~PreprocessHierarchyCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void preprocessHierarchy(const String& graphID);
+	static StaticGraph& getFrozenGraph(Graph& graph);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setGraphID(args::Positional<String, StringReader>& id);
+
+private:
+	String graphID;
+};
+
+#endif //__PREPROCESS_HIERARCHY_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
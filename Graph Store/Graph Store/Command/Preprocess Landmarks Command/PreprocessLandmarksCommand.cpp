@@ -0,0 +1,64 @@
+#include "PreprocessLandmarksCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Shortest Path Algorithms/Landmarks/Landmarks.h"
+
+static CommandRegistrator<PreprocessLandmarksCommand> registrator("PREPROCESS-LANDMARKS",
+																  "Picks landmarks in a graph and measures the distances to and from them for the alt algorithm");
+
+void PreprocessLandmarksCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	preprocessLandmarks(graphID, landmarksCount);
+}
+
+void PreprocessLandmarksCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> id(parser, "graph id", "The identifier of the graph");
+	args::Positional<unsigned> count(parser, "count", "The number of landmarks to pick");
+
+	parser.Parse();
+
+	setGraphID(id);
+	setLandmarksCount(count);
+}
+
+void PreprocessLandmarksCommand::setGraphID(args::Positional<String, StringReader>& id)
+{
+	if (id.Matched())
+	{
+		graphID = args::get(id);
+	}
+	else
+	{
+		throw MissingArgumentException(id.Name());
+	}
+}
+
+void PreprocessLandmarksCommand::setLandmarksCount(args::Positional<unsigned>& count)
+{
+	if (!count.Matched())
+	{
+		throw MissingArgumentException(count.Name());
+	}
+	else if (args::get(count) == 0)
+	{
+		throw CommandException(String("The number of landmarks must be positive!"));
+	}
+
+	landmarksCount = args::get(count);
+}
+
+void PreprocessLandmarksCommand::preprocessLandmarks(const String& graphID, unsigned count)
+{
+	Graph& graph = getGraphs().getGraphWithID(graphID);
+
+	try
+	{
+		graph.setLandmarks(std::unique_ptr<Landmarks>(new Landmarks(graph, count)));
+	}
+	catch (std::bad_alloc&)
+	{
+		throw CommandException(String("Not enough memory for the landmarks!"));
+	}
+}
\ No newline at end of file
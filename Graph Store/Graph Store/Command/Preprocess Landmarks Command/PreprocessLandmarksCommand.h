@@ -0,0 +1,32 @@
+#ifndef __PREPROCESS_LANDMARKS_COMMAND_HEADER_INCLUDED__
+#define __PREPROCESS_LANDMARKS_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+
+class PreprocessLandmarksCommand : public Command
+{
+public:
+	PreprocessLandmarksCommand() = default;
+	PreprocessLandmarksCommand(const PreprocessLandmarksCommand&) = delete;
+	PreprocessLandmarksCommand& operator=(const PreprocessLandmarksCommand&) = delete;
+	PreprocessLandmarksCommand(PreprocessLandmarksCommand&&) = delete;
+	PreprocessLandmarksCommand& operator=(PreprocessLandmarksCommand&&) = delete;
+	virtual ~PreprocessLandmarksCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void preprocessLandmarks(const String& graphID, unsigned count);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setGraphID(args::Positional<String, StringReader>& id);
+	void setLandmarksCount(args::Positional<unsigned>& count);
+
+private:
+	String graphID;
+	unsigned landmarksCount;
+};
+
+#endif //__PREPROCESS_LANDMARKS_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "PrintPathCacheCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../../Shortest Path Algorithms/Path Cache/PathCache.h"
+#include <iostream>
+
+static CommandRegistrator<PrintPathCacheCommand> registrator("PRINT-PATH-CACHE",
+															 "Prints the hits, the misses and the memory of the cache of the paths found by SEARCH");
+
+void PrintPathCacheCommand::execute(args::Subparser& parser)
+{
+	parser.Parse();
+	printPathCache();
+}
+
+void PrintPathCacheCommand::printPathCache()
+{
+	const PathCache& cache = PathCache::instance();
+
+	std::cout << "Hits: " << cache.getHitsCount() << '\n'
+			  << "Misses: " << cache.getMissesCount() << '\n'
+			  << "Paths: " << cache.getEntriesCount() << '\n'
+			  << "Memory: " << cache.getMemoryUsage() << " of " << cache.getMemoryLimit() << " bytes\n";
+}
\ No newline at end of file
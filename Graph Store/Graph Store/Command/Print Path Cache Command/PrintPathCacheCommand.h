@@ -0,0 +1,22 @@
+#ifndef __PRINT_PATH_CACHE_COMMAND_HEADER_INCLUDED__
+#define __PRINT_PATH_CACHE_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+
+class PrintPathCacheCommand : public Command
+{
+public:
+	PrintPathCacheCommand() = default;
+	PrintPathCacheCommand(const PrintPathCacheCommand&) = delete;
+	PrintPathCacheCommand& operator=(const PrintPathCacheCommand&) = delete;
+	PrintPathCacheCommand(PrintPathCacheCommand&&) = delete;
+	PrintPathCacheCommand& operator=(PrintPathCacheCommand&&) = delete;
+	virtual ~PrintPathCacheCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void printPathCache();
+};
+
+#endif //__PRINT_PATH_CACHE_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
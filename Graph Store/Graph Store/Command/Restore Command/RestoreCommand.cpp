@@ -0,0 +1,45 @@
+#include "RestoreCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Graph Snapshot/Snapshot Reader/SnapshotReader.h"
+
+static CommandRegistrator<RestoreCommand> registrator("RESTORE",
+													  "Replaces all graphs with the ones in a snapshot file");
+
+void RestoreCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	restoreGraphs(fileName);
+}
+
+void RestoreCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> fileName(parser, "file name", "The snapshot file to restore");
+	parser.Parse();
+	setFileName(fileName);
+}
+
+void RestoreCommand::setFileName(args::Positional<String, StringReader>& fileName)
+{
+	if (fileName.Matched())
+	{
+		this->fileName = args::get(fileName);
+	}
+	else
+	{
+		throw MissingArgumentException(fileName.Name());
+	}
+}
+
+///
+/// The snapshot is read whole before the current graphs are replaced, so
+/// they are kept if it cannot be restored.
+///
+void RestoreCommand::restoreGraphs(const String& fileName)
+{
+	SnapshotReader reader;
+	GraphCollection graphs = reader.read(fileName);
+
+	useNoGraph();
+	getGraphs() = std::move(graphs);
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef __RESTORE_COMMAND_HEADER_INCLUDED__
+#define __RESTORE_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+
+class RestoreCommand : public Command
+{
+public:
+	RestoreCommand() = default;
+	RestoreCommand(const RestoreCommand&) = delete;
+	RestoreCommand& operator=(const RestoreCommand&) = delete;
+	RestoreCommand(RestoreCommand&&) = delete;
+	RestoreCommand& operator=(RestoreCommand&&) = delete;
+	virtual ~RestoreCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void restoreGraphs(const String& fileName);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setFileName(args::Positional<String, StringReader>& fileName);
+
+private:
+	String fileName;
+};
+
+#endif //__RESTORE_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include "SaveCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Graph Snapshot/Snapshot Writer/SnapshotWriter.h"
+
+static CommandRegistrator<SaveCommand> registrator("SAVE", "Saves all graphs to a snapshot file");
+
+void SaveCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	saveGraphs(fileName);
+}
+
+void SaveCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> fileName(parser, "file name", "The file to save the snapshot to");
+	parser.Parse();
+	setFileName(fileName);
+}
+
+void SaveCommand::setFileName(args::Positional<String, StringReader>& fileName)
+{
+	if (fileName.Matched())
+	{
+		this->fileName = args::get(fileName);
+	}
+	else
+	{
+		throw MissingArgumentException(fileName.Name());
+	}
+}
+
+void SaveCommand::saveGraphs(const String& fileName)
+{
+	SnapshotWriter writer;
+	writer.write(getGraphs(), fileName);
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef __SAVE_COMMAND_HEADER_INCLUDED__
+#define __SAVE_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+
+class SaveCommand : public Command
+{
+public:
+	SaveCommand() = default;
+	SaveCommand(const SaveCommand&) = delete;
+	SaveCommand& operator=(const SaveCommand&) = delete;
+	SaveCommand(SaveCommand&&) = delete;
+	SaveCommand& operator=(SaveCommand&&) = delete;
+	virtual ~SaveCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void saveGraphs(const String& fileName);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setFileName(args::Positional<String, StringReader>& fileName);
+
+private:
+	String fileName;
+};
+
+#endif //__SAVE_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -1,16 +1,18 @@
 #include "SearchCommand.h"
 #include "../../Shortest Path Algorithms/Store/ShortestPathAlgorithmsStore.h"
 #include "../Command Registrator/CommandRegistrator.h"
-#include "../../Shortest Path Algorithms/Path Printing/PathPrinting.h"
+#include "../../Shortest Path Algorithms/All Pairs Shortest Paths/AllPairsShortestPaths.h"
+#include "../../Shortest Path Algorithms/Dynamic Shortest Path Tree/DynamicShortestPathTree.h"
+#include "../../Shortest Path Algorithms/Path Cache/PathCache.h"
 #include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include <iostream>
 
 static CommandRegistrator<SearchCommand> registrator("SEARCH", "Finds a shortest path between two vertices");
 
 void SearchCommand::execute(args::Subparser& parser)
 {
 	parseArguments(parser);
-	PathEnds ends = findShortestPath(sourceID, targetID, algorithmID);
-	printPathAndItsLength(ends.source, ends.target);
+	findShortestPath(sourceID, targetID, algorithmID).print(std::cout);
 }
 
 void SearchCommand::parseArguments(args::Subparser& parser)
@@ -62,9 +64,16 @@ void SearchCommand::setAlgorithmID(args::Positional<String, StringReader>& id)
 	}
 }
 
-SearchCommand::PathEnds SearchCommand::findShortestPath(const String& sourceID,
-														const String& targetID,
-														const String& algorithmID)
+///
+/// A graph with all pairs shortest paths computed (see APSP) answers from
+/// them, and so does the tree of a watched source (see WATCH-SOURCE), but
+/// only for an algorithm which finds weighted shortest paths as well, since
+/// the paths they hold are the shortest by weight. Otherwise the path cache
+/// is tried before searching.
+///
+ShortestPathAlgorithm::Path SearchCommand::findShortestPath(const String& sourceID,
+															const String& targetID,
+															const String& algorithmID)
 {
 	Graph& usedGraph = getUsedGraph();
 	Vertex& source = usedGraph.getVertexWithID(sourceID);
@@ -73,7 +82,33 @@ SearchCommand::PathEnds SearchCommand::findShortestPath(const String& sourceID,
 	ShortestPathAlgorithm& algorithm =
 		ShortestPathAlgorithmsStore::instance().searchForAlgorithm(algorithmID);
 
-	algorithm.findShortestPath(usedGraph, source, target);
+	if (algorithm.findsWeightedShortestPaths())
+	{
+		const AllPairsShortestPaths* paths = usedGraph.getAllPairsShortestPaths();
+
+		if (paths != nullptr)
+		{
+			return paths->getPathBetween(source, target);
+		}
+
+		const DynamicShortestPathTree* tree = usedGraph.getWatchedTreeOf(source);
+
+		if (tree != nullptr)
+		{
+			return tree->getPathTo(target);
+		}
+	}
+
+	PathCache& cache = PathCache::instance();
+	const ShortestPathAlgorithm::Path* cachedPath = cache.search(usedGraph, source, target, algorithm);
+
+	if (cachedPath != nullptr)
+	{
+		return *cachedPath;
+	}
+
+	ShortestPathAlgorithm::Path path = algorithm.findShortestPath(usedGraph, source, target);
+	cache.add(usedGraph, source, target, algorithm, path);
 
-	return PathEnds(source, target);
+	return path;
 }
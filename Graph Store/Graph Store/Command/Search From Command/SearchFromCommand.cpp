@@ -0,0 +1,90 @@
+#include "SearchFromCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+#include "../../Shortest Path Algorithms/Shortest Path Tree/ShortestPathTree.h"
+#include <iostream>
+
+static CommandRegistrator<SearchFromCommand> registrator("SEARCH-FROM",
+														 "Finds shortest paths from a vertex to several vertices with a single search");
+
+void SearchFromCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+	searchFrom(sourceID, targetIDs, isSearchingAll);
+}
+
+void SearchFromCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> sourceID(parser, "source id", "The identifier of the source vertex");
+	args::PositionalList<String, std::vector, StringReader> targetIDs(parser, "target ids", "The identifiers of the target vertices");
+	args::Flag all(parser, "all", "Find the paths to all vertices", { "all" });
+
+	parser.Parse();
+
+	setSourceID(sourceID);
+	setTargets(targetIDs, all);
+}
+
+void SearchFromCommand::setSourceID(args::Positional<String, StringReader>& id)
+{
+	if (id.Matched())
+	{
+		sourceID = args::get(id);
+	}
+	else
+	{
+		throw MissingArgumentException(id.Name());
+	}
+}
+
+void SearchFromCommand::setTargets(args::PositionalList<String, std::vector, StringReader>& ids, args::Flag& all)
+{
+	if (ids.Matched() && all.Matched())
+	{
+		throw CommandException(String("Either target identifiers or --all must be given, not both!"));
+	}
+	else if (!ids.Matched() && !all.Matched())
+	{
+		throw MissingArgumentException(ids.Name());
+	}
+
+	isSearchingAll = all.Matched();
+	targetIDs = isSearchingAll ? IdentifiersArray() : args::get(ids);
+}
+
+///
+/// The targets are looked up before searching, so a missing one is
+/// reported without any work done.
+///
+void SearchFromCommand::searchFrom(const String& sourceID, const IdentifiersArray& targetIDs, bool isSearchingAll)
+{
+	Graph& usedGraph = getUsedGraph();
+	const Vertex& source = usedGraph.getVertexWithID(sourceID);
+	ShortestPathTree::VerticesArray targets;
+
+	if (isSearchingAll)
+	{
+		targets.resize(usedGraph.getVerticesCount());
+
+		forEach(*usedGraph.getConstIteratorOfVertices(), [&](const Vertex* v)
+		{
+			targets[v->getIndex()] = v;
+		});
+	}
+	else
+	{
+		for (const String& id : targetIDs)
+		{
+			targets.push_back(&usedGraph.getVertexWithID(id));
+		}
+	}
+
+	ShortestPathTree tree;
+	tree.grow(usedGraph, source, isSearchingAll ? ShortestPathTree::VerticesArray() : targets);
+
+	for (const Vertex* target : targets)
+	{
+		std::cout << "Target: " << target->getID() << '\n';
+		tree.getPathTo(*target).print(std::cout);
+	}
+}
\ No newline at end of file
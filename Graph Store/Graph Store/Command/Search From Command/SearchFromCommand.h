@@ -0,0 +1,36 @@
+#ifndef __SEARCH_FROM_COMMAND_HEADER_INCLUDED__
+#define __SEARCH_FROM_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+#include <vector>
+
+class SearchFromCommand : public Command
+{
+	typedef std::vector<String> IdentifiersArray;
+
+public:
+	SearchFromCommand() = default;
+	SearchFromCommand(const SearchFromCommand&) = delete;
+	SearchFromCommand& operator=(const SearchFromCommand&) = delete;
+	SearchFromCommand(SearchFromCommand&&) = delete;
+	SearchFromCommand& operator=(SearchFromCommand&&) = delete;
+	virtual ~SearchFromCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void searchFrom(const String& sourceID, const IdentifiersArray& targetIDs, bool isSearchingAll);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setSourceID(args::Positional<String, StringReader>& id);
+	void setTargets(args::PositionalList<String, std::vector, StringReader>& ids, args::Flag& all);
+
+private:
+	String sourceID;
+	IdentifiersArray targetIDs;
+	bool isSearchingAll;
+};
+
+#endif //__SEARCH_FROM_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
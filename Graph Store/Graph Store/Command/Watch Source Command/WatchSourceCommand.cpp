@@ -0,0 +1,65 @@
+#include "WatchSourceCommand.h"
+#include "../Command Registrator/CommandRegistrator.h"
+#include "../Exceptions/Missing Argument Exception/MissingArgumentException.h"
+
+static CommandRegistrator<WatchSourceCommand> registrator("WATCH-SOURCE",
+														  "Keeps the shortest paths from a vertex of the used graph up to date for SEARCH");
+
+void WatchSourceCommand::execute(args::Subparser& parser)
+{
+	parseArguments(parser);
+
+	if (stops)
+	{
+		stopWatching(vertexID);
+	}
+	else
+	{
+		watchSource(vertexID);
+	}
+}
+
+void WatchSourceCommand::parseArguments(args::Subparser& parser)
+{
+	args::Positional<String, StringReader> id(parser, "vertex id", "The identifier of the source vertex");
+	args::Flag stop(parser, "stop", "Stop watching the vertex", { "stop" });
+
+	parser.Parse();
+
+	setVertexID(id);
+	stops = stop.Matched();
+}
+
+void WatchSourceCommand::setVertexID(args::Positional<String, StringReader>& id)
+{
+	if (id.Matched())
+	{
+		vertexID = args::get(id);
+	}
+	else
+	{
+		throw MissingArgumentException(id.Name());
+	}
+}
+
+void WatchSourceCommand::watchSource(const String& id)
+{
+	Graph& usedGraph = getUsedGraph();
+	Vertex& source = usedGraph.getVertexWithID(id);
+
+	try
+	{
+		usedGraph.watchSource(source);
+	}
+	catch (std::bad_alloc&)
+	{
+		throw CommandException(String("Not enough memory to watch the vertex!"));
+	}
+}
+
+void WatchSourceCommand::stopWatching(const String& id)
+{
+	Graph& usedGraph = getUsedGraph();
+
+	usedGraph.stopWatching(usedGraph.getVertexWithID(id));
+}
\ No newline at end of file
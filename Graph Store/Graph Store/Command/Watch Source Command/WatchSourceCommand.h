@@ -0,0 +1,32 @@
+#ifndef __WATCH_SOURCE_COMMAND_HEADER_INCLUDED__
+#define __WATCH_SOURCE_COMMAND_HEADER_INCLUDED__
+
+#include "../Abstract class/Command.h"
+#include "../String Reader/StringReader.h"
+
+class WatchSourceCommand : public Command
+{
+public:
+	WatchSourceCommand() = default;
+	WatchSourceCommand(const WatchSourceCommand&) = delete;
+	WatchSourceCommand& operator=(const WatchSourceCommand&) = delete;
+	WatchSourceCommand(WatchSourceCommand&&) = delete;
+	WatchSourceCommand& operator=(WatchSourceCommand&&) = delete;
+	virtual ~WatchSourceCommand() = default;
+
+	virtual void execute(args::Subparser& parser) override;
+
+private:
+	static void watchSource(const String& id);
+	static void stopWatching(const String& id);
+
+private:
+	void parseArguments(args::Subparser& parser);
+	void setVertexID(args::Positional<String, StringReader>& id);
+
+private:
+	String vertexID;
+	bool stops;
+};
+
+#endif //__WATCH_SOURCE_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -1,107 +1,305 @@
 #include "DirectoryFilesIterator.h"
 #include <assert.h>
-#include "Directory Files Iterator Exception\DirectoryFilesIteratorException.h"
+#include <cctype>
+#include <cstring>
+#include "Directory Files Iterator Exception/DirectoryFilesIteratorException.h"
 
-const String DirectoryFilesIterator::pattern = "*.txt";
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
 
-DirectoryFilesIterator::DirectoryFilesIterator()
-{
-	invalidateHandle();
-}
+const String DirectoryFilesIterator::DEFAULT_PATTERN = "*.txt";
 
-void DirectoryFilesIterator::invalidateHandle()
+#ifdef _WIN32
+const char DirectoryFilesIterator::SEPARATOR = '\\';
+#else
+const char DirectoryFilesIterator::SEPARATOR = '/';
+#endif
+
+DirectoryFilesIterator::DirectoryFilesIterator() :
+	isRecursive(false)
 {
-	handle = INVALID_HANDLE_VALUE;
+	invalidateHandle();
 }
 
-DirectoryFilesIterator::DirectoryFilesIterator(const String& path) :
+DirectoryFilesIterator::DirectoryFilesIterator(const String& path, const String& pattern, bool isRecursive) :
 	DirectoryFilesIterator()
 {
-	startIterationIn(path);
+	startIterationIn(path, pattern, isRecursive);
 }
 
-void DirectoryFilesIterator::startIterationIn(const String& path)
+void DirectoryFilesIterator::startIterationIn(const String& path, const String& pattern, bool isRecursive)
 {
 	if (isValid())
 	{
 		endIteration();
 	}
 
-	setPath(path);
-	String pathWithPattern = getPathWithAppendedPattern();
-	handle = FindFirstFile(pathWithPattern.cString(), &file);
-	throwExceptionIfFailedToOpenDirectory(path);
+	this->pattern = pattern;
+	this->isRecursive = isRecursive;
+
+	if (!openDirectory(path))
+	{
+		throw DirectoryFilesIteratorException("Could not open directory: " + path);
+	}
+
+	goToNextMatchingFile();
 }
 
 bool DirectoryFilesIterator::isValid() const
 {
+#ifdef _WIN32
 	return handle != INVALID_HANDLE_VALUE;
+#else
+	return handle != nullptr;
+#endif
 }
 
 void DirectoryFilesIterator::endIteration()
 {
 	assert(isValid());
 
-	FindClose(handle);
-	invalidateHandle();
+	closeDirectory();
+	directoriesToVisit.clear();
 }
 
-void DirectoryFilesIterator::setPath(const String& path)
+DirectoryFilesIterator::~DirectoryFilesIterator()
 {
-	this->path = path + '\\';
+	if (isValid())
+	{
+		endIteration();
+	}
 }
 
-String DirectoryFilesIterator::getPathWithAppendedPattern() const
+void DirectoryFilesIterator::advance()
 {
-	return path + pattern;
+	if (!isValid())
+	{
+		return;
+	}
+
+	goToNextMatchingFile();
 }
 
-void DirectoryFilesIterator::throwExceptionIfFailedToOpenDirectory(const String& path) const
+void DirectoryFilesIterator::goToNextMatchingFile()
 {
-	if (failedToOpenDirectory())
+	while (isValid())
 	{
-		throw DirectoryFilesIteratorException("Could not open directory: " + path);
+		if (!readEntry())
+		{
+			closeDirectory();
+			openNextDirectoryToVisit();
+		}
+		else if (entryIsDirectory())
+		{
+			if (isRecursive && !isSelfOrParent(getNameOfEntry()))
+			{
+				directoriesToVisit.push_back(path + getNameOfEntry());
+			}
+		}
+		else if (matches(getNameOfEntry(), pattern.cString()))
+		{
+			nameOfCurrentFile = getNameOfEntry();
+			return;
+		}
 	}
 }
 
-bool DirectoryFilesIterator::failedToOpenDirectory() const
+void DirectoryFilesIterator::openNextDirectoryToVisit()
 {
-	return !isValid() && GetLastError() != ERROR_FILE_NOT_FOUND;
-}
+	assert(!isValid());
 
-DirectoryFilesIterator::~DirectoryFilesIterator()
-{
-	if (isValid())
+	while (!directoriesToVisit.empty())
 	{
-		endIteration();
+		String nextPath = directoriesToVisit.back();
+		directoriesToVisit.pop_back();
+
+		if (openDirectory(nextPath))
+		{
+			return;
+		}
 	}
 }
 
-void DirectoryFilesIterator::advance()
+///
+/// Matches with backtracking to the last '*' only, which is enough since a
+/// later '*' can always take over what an earlier one would have matched.
+///
+bool DirectoryFilesIterator::matches(const char* name, const char* pattern)
 {
-	if (!isValid())
+	const char* starInPattern = nullptr;
+	const char* nameAfterStar = nullptr;
+
+	while (*name != '\0')
 	{
-		return;
+		if (*pattern == '*')
+		{
+			starInPattern = pattern++;
+			nameAfterStar = name;
+		}
+		else if (*pattern == '?' || (*pattern != '\0' && areSameCharacter(*pattern, *name)))
+		{
+			++pattern;
+			++name;
+		}
+		else if (starInPattern != nullptr)
+		{
+			pattern = starInPattern + 1;
+			name = ++nameAfterStar;
+		}
+		else
+		{
+			return false;
+		}
 	}
 
-	bool foundAFile = FindNextFile(handle, &file);
-
-	if (!foundAFile)
+	while (*pattern == '*')
 	{
-		endIteration();
+		++pattern;
 	}
+
+	return *pattern == '\0';
+}
+
+///
+/// Names differing only in case are the same name on Windows, so they are
+/// matched as such there.
+///
+bool DirectoryFilesIterator::areSameCharacter(char lhs, char rhs)
+{
+#ifdef _WIN32
+	return tolower(static_cast<unsigned char>(lhs)) == tolower(static_cast<unsigned char>(rhs));
+#else
+	return lhs == rhs;
+#endif
+}
+
+bool DirectoryFilesIterator::isSelfOrParent(const char* name)
+{
+	return strcmp(name, ".") == 0 || strcmp(name, "..") == 0;
 }
 
 String DirectoryFilesIterator::getNameOfCurrentFile() const
 {
 	assert(isValid());
 
-	return file.cFileName;
+	return nameOfCurrentFile;
 }
 
 String DirectoryFilesIterator::getPathOfCurrentFile() const
 {
 	assert(isValid());
 
-	return path + file.cFileName;
+	return path + nameOfCurrentFile;
+}
+
+#ifdef _WIN32
+
+void DirectoryFilesIterator::invalidateHandle()
+{
+	handle = INVALID_HANDLE_VALUE;
+}
+
+///
+/// FindFirstFile reads the first entry right away, so it is kept to be
+/// returned by the first call of readEntry.
+///
+bool DirectoryFilesIterator::openDirectory(const String& path)
+{
+	assert(!isValid());
+
+	this->path = path + SEPARATOR;
+	handle = FindFirstFile((this->path + '*').cString(), &entry);
+	hasUnreadEntry = true;
+
+	return isValid();
+}
+
+bool DirectoryFilesIterator::readEntry()
+{
+	if (hasUnreadEntry)
+	{
+		hasUnreadEntry = false;
+		return true;
+	}
+
+	return FindNextFile(handle, &entry) != 0;
+}
+
+void DirectoryFilesIterator::closeDirectory()
+{
+	assert(isValid());
+
+	FindClose(handle);
+	invalidateHandle();
+}
+
+const char* DirectoryFilesIterator::getNameOfEntry() const
+{
+	return entry.cFileName;
+}
+
+bool DirectoryFilesIterator::entryIsDirectory() const
+{
+	return (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+}
+
+#else
+
+void DirectoryFilesIterator::invalidateHandle()
+{
+	handle = nullptr;
 }
+
+///
+/// readdir goes through getdents with a buffer of many entries, so it
+/// makes no system call for most of the entries.
+///
+bool DirectoryFilesIterator::openDirectory(const String& path)
+{
+	assert(!isValid());
+
+	this->path = path + SEPARATOR;
+	handle = opendir(path.cString());
+
+	return isValid();
+}
+
+bool DirectoryFilesIterator::readEntry()
+{
+	entry = readdir(handle);
+
+	return entry != nullptr;
+}
+
+void DirectoryFilesIterator::closeDirectory()
+{
+	assert(isValid());
+
+	closedir(handle);
+	invalidateHandle();
+}
+
+const char* DirectoryFilesIterator::getNameOfEntry() const
+{
+	return entry->d_name;
+}
+
+///
+/// Some file systems do not report the type of an entry, which then takes
+/// an lstat. Symbolic links are not followed, so a link to a directory
+/// cannot make the iteration loop.
+///
+bool DirectoryFilesIterator::entryIsDirectory() const
+{
+	if (entry->d_type != DT_UNKNOWN)
+	{
+		return entry->d_type == DT_DIR;
+	}
+
+	struct stat status;
+
+	return lstat((path + entry->d_name).cString(), &status) == 0 && S_ISDIR(status.st_mode);
+}
+
+#endif
\ No newline at end of file
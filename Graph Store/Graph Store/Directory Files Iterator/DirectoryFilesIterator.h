@@ -1,44 +1,84 @@
 #ifndef __DIRECTORY_FILES_ITERATOR_HEADER_INCLUDED__
 #define __DIRECTORY_FILES_ITERATOR_HEADER_INCLUDED__
 
+#ifdef _WIN32
 #include <windows.h>
+#else
+#include <dirent.h>
+#endif
+#include <vector>
 #include "../String/String.h"
 
+///
+/// Iterates over the files in a directory whose names match a pattern, in
+/// which '*' stands for any characters and '?' for any one character.
+///
+/// A recursive iteration goes through the files of a directory and then
+/// through its subdirectories, one directory open at a time. A subdirectory
+/// which cannot be opened, e.g. for lack of permissions, is skipped.
+///
 class DirectoryFilesIterator
 {
+#ifdef _WIN32
 	typedef HANDLE SearchHandle;
-	typedef WIN32_FIND_DATA File;
+	typedef WIN32_FIND_DATA Entry;
+#else
+	typedef DIR* SearchHandle;
+	typedef dirent* Entry;
+#endif
 
 public:
 	DirectoryFilesIterator();
-	explicit DirectoryFilesIterator(const String& path);
+	explicit DirectoryFilesIterator(const String& path,
+									const String& pattern = DEFAULT_PATTERN,
+									bool isRecursive = false);
 	DirectoryFilesIterator(const DirectoryFilesIterator&) = delete;
 	DirectoryFilesIterator& operator=(const DirectoryFilesIterator&) = delete;
 	DirectoryFilesIterator(DirectoryFilesIterator&&) = delete;
 	DirectoryFilesIterator& operator=(DirectoryFilesIterator&&) = delete;
 	~DirectoryFilesIterator();
 
-	void startIterationIn(const String& path);
+	void startIterationIn(const String& path,
+						  const String& pattern = DEFAULT_PATTERN,
+						  bool isRecursive = false);
 	void advance();
 	bool isValid() const;
 	String getNameOfCurrentFile() const;
 	String getPathOfCurrentFile() const;
 
+public:
+	static const String DEFAULT_PATTERN;
+
+private:
+	static bool matches(const char* name, const char* pattern);
+	static bool areSameCharacter(char lhs, char rhs);
+	static bool isSelfOrParent(const char* name);
+
 private:
+	void goToNextMatchingFile();
+	void openNextDirectoryToVisit();
 	void endIteration();
 	void invalidateHandle();
-	void setPath(const String& path);
-	String getPathWithAppendedPattern() const;
-	void throwExceptionIfFailedToOpenDirectory(const String& path) const;
-	bool failedToOpenDirectory() const;
+	bool openDirectory(const String& path);
+	bool readEntry();
+	void closeDirectory();
+	const char* getNameOfEntry() const;
+	bool entryIsDirectory() const;
 
 private:
-	static const String pattern;
+	static const char SEPARATOR;
 
 private:
+	String pattern;
+	bool isRecursive;
+	std::vector<String> directoriesToVisit;
 	String path;
+	String nameOfCurrentFile;
 	SearchHandle handle;
-	File file;
+	Entry entry;
+#ifdef _WIN32
+	bool hasUnreadEntry;
+#endif
 };
 
 #endif //__DIRECTORY_FILES_ITERATOR_HEADER_INCLUDED__
\ No newline at end of file
@@ -1,16 +1,85 @@
 #include "DirectoryLoader.h"
+#include <algorithm>
 #include <assert.h>
 #include "../Graph Builder/Graph Builder Exception/GraphBuilderException.h"
 #include "../Directory Files Iterator/Directory Files Iterator Exception/DirectoryFilesIteratorException.h"
 #include "../Logger/Logger.h"
+#include "../Mapped File/MappedFile.h"
+#include "../Thread Pool/ThreadPool.h"
 
-void DirectoryLoader::openDirectory(const String& path)
+DirectoryLoader::DirectoryLoader(size_t threadsCount, size_t maxGraphsInFlight) :
+	threadsCount(threadsCount),
+	maxGraphsInFlight(maxGraphsInFlight),
+	nextFileToLoad(0),
+	nextFileToHandOver(0),
+	isAborted(false)
+{
+	assert(threadsCount > 0);
+	assert(maxGraphsInFlight > 0);
+}
+
+///
+/// The calling thread hands over the graphs and builds the next files
+/// itself while the graph to hand over next is not built yet, so with one
+/// thread the files are loaded one after another as before.
+///
+void DirectoryLoader::loadApplyingFunctionToEachGraph(const String& path,
+													   const Function& function,
+													   const String& pattern,
+													   bool isRecursive)
+{
+	collectPathsOfFilesIn(path, pattern, isRecursive);
+	loadedFiles.resize(paths.size());
+	prefetchFirstFiles();
+
+	std::vector<GraphBuilder> builders(std::min(threadsCount, std::max(paths.size(), size_t(1))));
+	ThreadPool pool(builders.size());
+
+	try
+	{
+		pool.runOnEveryThread([&](size_t threadIndex)
+		{
+			if (threadIndex == 0)
+			{
+				handOverLoadedFiles(function, builders[threadIndex]);
+			}
+			else
+			{
+				loadFiles(builders[threadIndex]);
+			}
+		});
+	}
+	catch (...)
+	{
+		clean();
+		throw;
+	}
+
+	clean();
+}
+
+void DirectoryLoader::collectPathsOfFilesIn(const String& path, const String& pattern, bool isRecursive)
+{
+	assert(paths.empty());
+
+	openDirectory(path, pattern, isRecursive);
+
+	while (directoryIterator.isValid())
+	{
+		paths.push_back(directoryIterator.getPathOfCurrentFile());
+		directoryIterator.advance();
+	}
+
+	std::sort(paths.begin(), paths.end());
+}
+
+void DirectoryLoader::openDirectory(const String& path, const String& pattern, bool isRecursive)
 {
 	assert(!directoryIterator.isValid());
 
 	try
 	{
-		directoryIterator.startIterationIn(path);
+		directoryIterator.startIterationIn(path, pattern, isRecursive);
 	}
 	catch (DirectoryFilesIteratorException& e)
 	{
@@ -19,27 +88,163 @@ void DirectoryLoader::openDirectory(const String& path)
 	}
 }
 
-bool DirectoryLoader::thereAreFilesLeftToLoad() const
+void DirectoryLoader::prefetchFirstFiles() const
+{
+	for (size_t i = 0; i < READ_AHEAD_FILES_COUNT && i < paths.size(); ++i)
+	{
+		MappedFile::prefetch(paths[i]);
+	}
+}
+
+void DirectoryLoader::handOverLoadedFiles(const Function& function, GraphBuilder& builder)
+{
+	try
+	{
+		while (nextFileToHandOver < paths.size())
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			LoadedFile& file = loadedFiles[nextFileToHandOver];
+			size_t index;
+
+			if (file.isLoaded)
+			{
+				++nextFileToHandOver;
+				lock.unlock();
+				fileHandedOver.notify_all();
+
+				handOver(file, function);
+			}
+			else if (tryToClaimNextFile(index))
+			{
+				lock.unlock();
+				loadFile(index, builder);
+			}
+			else
+			{
+				fileLoaded.wait(lock, [&]() { return file.isLoaded; });
+			}
+		}
+	}
+	catch (...)
+	{
+		abort();
+		throw;
+	}
+}
+
+///
+/// Only the errors in the files are logged; any other exception stops
+/// the loading.
+///
+void DirectoryLoader::handOver(LoadedFile& file, const Function& function)
+{
+	std::unique_ptr<Graph> graph = std::move(file.graph);
+	std::exception_ptr error = file.error;
+	file.error = nullptr;
+
+	if (error)
+	{
+		try
+		{
+			std::rethrow_exception(error);
+		}
+		catch (GraphBuilderException& e)
+		{
+			Logger::logError(e);
+		}
+	}
+	else if (graph != nullptr)
+	{
+		function(std::move(graph));
+	}
+}
+
+void DirectoryLoader::loadFiles(GraphBuilder& builder)
+{
+	size_t index;
+
+	while (claimNextFile(index))
+	{
+		loadFile(index, builder);
+	}
+}
+
+bool DirectoryLoader::claimNextFile(size_t& index)
 {
-	return directoryIterator.isValid();
+	std::unique_lock<std::mutex> lock(mutex);
+
+	fileHandedOver.wait(lock, [&]()
+	{
+		return isAborted || nextFileToLoad == paths.size() || canClaimNextFile();
+	});
+
+	return tryToClaimNextFile(index);
 }
 
-std::unique_ptr<Graph> DirectoryLoader::loadCurrentFile()
+bool DirectoryLoader::tryToClaimNextFile(size_t& index)
 {
-	assert(directoryIterator.isValid());
+	if (isAborted || !canClaimNextFile())
+	{
+		return false;
+	}
+
+	index = nextFileToLoad++;
+
+	return true;
+}
+
+bool DirectoryLoader::canClaimNextFile() const
+{
+	return nextFileToLoad < paths.size()
+		   && nextFileToLoad - nextFileToHandOver < maxGraphsInFlight;
+}
+
+void DirectoryLoader::loadFile(size_t index, GraphBuilder& builder)
+{
+	std::unique_ptr<Graph> graph;
+	std::exception_ptr error;
+
+	if (index + READ_AHEAD_FILES_COUNT < paths.size())
+	{
+		MappedFile::prefetch(paths[index + READ_AHEAD_FILES_COUNT]);
+	}
 
 	try
 	{
-		return graphBuilder.buildFromFile(directoryIterator.getPathOfCurrentFile());
+		graph = builder.buildFromFile(paths[index]);
 	}
-	catch (GraphBuilderException& e)
+	catch (...)
 	{
-		Logger::logError(e);
-		return nullptr;
+		error = std::current_exception();
 	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		LoadedFile& file = loadedFiles[index];
+
+		file.graph = std::move(graph);
+		file.error = error;
+		file.isLoaded = true;
+	}
+
+	fileLoaded.notify_one();
 }
 
-void DirectoryLoader::goToNextFile()
+void DirectoryLoader::abort()
 {
-	directoryIterator.advance();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isAborted = true;
+	}
+
+	fileHandedOver.notify_all();
 }
+
+void DirectoryLoader::clean()
+{
+	paths.clear();
+	loadedFiles.clear();
+	nextFileToLoad = 0;
+	nextFileToHandOver = 0;
+	isAborted = false;
+}
\ No newline at end of file
@@ -3,49 +3,81 @@
 
 #include "../Directory Files Iterator/DirectoryFilesIterator.h"
 #include "../Graph Builder/GraphBuilder.h"
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
 
+///
+/// Builds the graphs in the files of a directory on several threads, each
+/// with its own GraphBuilder. The graphs are handed over to the function on
+/// the calling thread only, in the order of the paths of their files, and
+/// the errors in the files are logged in that order too.
+///
+/// At most maxGraphsInFlight graphs are being built or waiting to be handed
+/// over at once, so a file which takes long to build does not let the
+/// graphs after it pile up in memory.
+///
+/// The paths are sorted since not every file system lists a directory in
+/// the same order. While a file is built, the
+/// file READ_AHEAD_FILES_COUNT places after it is prefetched, so that on a
+/// cold cache the disk is read while the files before it are parsed.
+///
 class DirectoryLoader
 {
+	struct LoadedFile
+	{
+		std::unique_ptr<Graph> graph;
+		std::exception_ptr error;
+		bool isLoaded;
+	};
+
+public:
+	typedef std::function<void(std::unique_ptr<Graph>)> Function;
+
 public:
-	DirectoryLoader() = default;
+	DirectoryLoader(size_t threadsCount = 1, size_t maxGraphsInFlight = 1);
 	DirectoryLoader(const DirectoryLoader&) = delete;
 	DirectoryLoader& operator=(const DirectoryLoader&) = delete;
 	DirectoryLoader(DirectoryLoader&&) = delete;
 	DirectoryLoader& operator=(DirectoryLoader&&) = delete;
 	~DirectoryLoader() = default;
 
-	template <class Function>
-	void loadApplyingFunctionToEachGraph(const String& path, const Function& function);
+	void loadApplyingFunctionToEachGraph(const String& path,
+										 const Function& function,
+										 const String& pattern = DirectoryFilesIterator::DEFAULT_PATTERN,
+										 bool isRecursive = false);
 
 private:
-	void openDirectory(const String& path);
-	bool thereAreFilesLeftToLoad() const;
-	std::unique_ptr<Graph> loadCurrentFile();
-	void goToNextFile();
+	void collectPathsOfFilesIn(const String& path, const String& pattern, bool isRecursive);
+	void openDirectory(const String& path, const String& pattern, bool isRecursive);
+	void prefetchFirstFiles() const;
+	void handOverLoadedFiles(const Function& function, GraphBuilder& builder);
+	void handOver(LoadedFile& file, const Function& function);
+	void loadFiles(GraphBuilder& builder);
+	bool claimNextFile(size_t& index);
+	bool tryToClaimNextFile(size_t& index);
+	bool canClaimNextFile() const;
+	void loadFile(size_t index, GraphBuilder& builder);
+	void abort();
+	void clean();
+
+private:
+	static const size_t READ_AHEAD_FILES_COUNT = 8;
 
 private:
 	DirectoryFilesIterator directoryIterator;
-	GraphBuilder graphBuilder;
+	std::vector<String> paths;
+	std::vector<LoadedFile> loadedFiles;
+	size_t threadsCount;
+	size_t maxGraphsInFlight;
+	size_t nextFileToLoad;
+	size_t nextFileToHandOver;
+	bool isAborted;
+	std::mutex mutex;
+	std::condition_variable fileLoaded;
+	std::condition_variable fileHandedOver;
 };
 
-template <class Function>
-void DirectoryLoader::loadApplyingFunctionToEachGraph(const String& path, const Function& function)
-{
-	openDirectory(path);
-
-	std::unique_ptr<Graph> graph;
-
-	while (thereAreFilesLeftToLoad())
-	{
-		graph = loadCurrentFile();
-
-		if (graph != nullptr)
-		{
-			function(std::move(graph));
-		}
-
-		goToNextFile();
-	}
-}
-
 #endif //__DIRECTORY_LOADER_HEADER_INCLUDED__
\ No newline at end of file
@@ -35,26 +35,31 @@ void GraphBuilder::openFile(const String& name)
 	}
 }
 
+///
+/// The vertices and edges are parsed first and then loaded into the graph
+/// at once (see GraphBase::bulkLoad).
+///
 void GraphBuilder::buildAGraph()
 {
 	createEmptyGraph();
-	addVerticesToTheCreatedGraph();
-	addEdgesHavingAddedVertices();
+	parseIdentifiers();
+	parseEdges();
+
+	graph->bulkLoad(identifiers, edges);
 }
 
 void GraphBuilder::createEmptyGraph()
 {
 	assert(graph == nullptr);
 
-	String id = fileParser.readLine();
-	String type = fileParser.readLine();
+	String id = fileParser.readLine().toString();
+	String type = fileParser.readLine().toString();
 
 	graph = GraphFactory::instance().createGraph(type, id);
 }
 
-void GraphBuilder::addVerticesToTheCreatedGraph()
+void GraphBuilder::parseIdentifiers()
 {
-	assert(graph != nullptr);
 	assert(identifiers.isEmpty());
 
 	unsigned identifiersCount = parseUnsignedAndSkipUntil(NEW_LINE);
@@ -62,33 +67,30 @@ void GraphBuilder::addVerticesToTheCreatedGraph()
 
 	for (unsigned i = 0; i < identifiersCount; ++i)
 	{
-		identifiers.add(fileParser.readLine());
-
-		graph->addVertex(identifiers[i]);
+		identifiers.add(fileParser.readLine().toString());
 	}
 }
 
-void GraphBuilder::addEdgesHavingAddedVertices()
+void GraphBuilder::parseEdges()
 {
-	assert(graph != nullptr);
+	assert(edges.empty());
 
 	unsigned edgesCount = parseUnsignedAndSkipUntil(NEW_LINE);
-	RawEdge rawEdge;
+	edges.reserve(edgesCount);
 
 	for (unsigned i = 1; i <= edgesCount; ++i)
 	{
-		rawEdge = parseEdge();
-		addEdge(rawEdge);
+		edges.push_back(parseEdge());
 	}
 }
 
-GraphBuilder::RawEdge GraphBuilder::parseEdge()
+Graph::IndexedEdge GraphBuilder::parseEdge()
 {
-	RawEdge edge;
+	Graph::IndexedEdge edge;
 
 	fileParser.skipUntil(EDGE_START);
-	edge.startIDIndex = parseUnsignedAndSkipUntil(EDGE_ATTRIBUTE_SEPARATOR);
-	edge.endIDIndex = parseUnsignedAndSkipUntil(EDGE_ATTRIBUTE_SEPARATOR);
+	edge.startIndex = parseUnsignedAndSkipUntil(EDGE_ATTRIBUTE_SEPARATOR);
+	edge.endIndex = parseUnsignedAndSkipUntil(EDGE_ATTRIBUTE_SEPARATOR);
 	edge.weight = parseUnsignedAndSkipUntil(EDGE_END);
 	fileParser.skipUntil(NEW_LINE);
 
@@ -103,17 +105,6 @@ unsigned GraphBuilder::parseUnsignedAndSkipUntil(char symbol)
 	return result;
 }
 
-void GraphBuilder::addEdge(const RawEdge& edge)
-{
-	String& startID = identifiers[edge.startIDIndex];
-	String& endID = identifiers[edge.endIDIndex];
-
-	Vertex& start = graph->getVertexWithID(startID);
-	Vertex& end = graph->getVertexWithID(endID);
-
-	graph->addEdge(start, end, edge.weight);
-}
-
 void GraphBuilder::handleExceptionDuringBuilding(const String& fileName, const std::exception& e)
 {
 	graph = nullptr;
@@ -125,5 +116,7 @@ void GraphBuilder::handleExceptionDuringBuilding(const String& fileName, const s
 void GraphBuilder::clean()
 {
 	identifiers.empty();
+	edges.clear();
+	edges.shrink_to_fit();
 	fileParser.closeFile();
 }
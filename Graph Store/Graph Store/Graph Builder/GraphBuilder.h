@@ -1,20 +1,13 @@
 #ifndef __GRAPH_BUILDER_HEADER_INCLUDED__
 #define __GRAPH_BUILDER_HEADER_INCLUDED__
 
-#include "../File Parser/FileParser.h"
+#include "../Mapped File Parser/MappedFileParser.h"
 #include "../String/String.h"
 #include "../Dynamic Array/DynamicArray.h"
 #include "../Graph/Abstract class/Graph.h"
 
 class GraphBuilder
 {
-	struct RawEdge
-	{
-		size_t startIDIndex;
-		size_t endIDIndex;
-		unsigned weight;
-	};
-
 public:
 	GraphBuilder() = default;
 	GraphBuilder(const GraphBuilder&) = delete;
@@ -29,10 +22,9 @@ private:
 	void openFile(const String& name);
 	void buildAGraph();
 	void createEmptyGraph();
-	void addVerticesToTheCreatedGraph();
-	void addEdgesHavingAddedVertices();
-	RawEdge parseEdge();
-	void addEdge(const RawEdge& edge);
+	void parseIdentifiers();
+	void parseEdges();
+	Graph::IndexedEdge parseEdge();
 	unsigned parseUnsignedAndSkipUntil(char symbol);
 	void handleExceptionDuringBuilding(const String& fileName, const std::exception& e);
 	void clean();
@@ -46,7 +38,8 @@ private:
 private:
 	std::unique_ptr<Graph> graph;
 	DynamicArray<String> identifiers;
-	FileParser fileParser;
+	Graph::IndexedEdgesArray edges;
+	MappedFileParser fileParser;
 };
 
 #endif //__GRAPH_BUILDER_HEADER_INCLUDED__
\ No newline at end of file
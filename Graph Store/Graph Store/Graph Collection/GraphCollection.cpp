@@ -1,5 +1,6 @@
 #include "GraphCollection.h"
 #include "../Runtime Error/RuntimeError.h"
+#include "../Iterator/ConcreteIteratorAdapter.h"
 
 GraphCollection& GraphCollection::operator=(GraphCollection&& rhs)
 {
@@ -20,7 +21,7 @@ void GraphCollection::empty()
 
 void GraphCollection::destroyAllGraphs()
 {
-	CollectionIterator iterator = graphs.getIteratorToFirst();
+	CollectionIterator iterator = graphs.getIterator();
 
 	forEach(iterator, [&](Graph* graph)
 	{
@@ -84,6 +85,16 @@ std::unique_ptr<Graph> GraphCollection::remove(const String& graphID)
 	return graph;
 }
 
+std::unique_ptr<Graph> GraphCollection::replace(Graph& graph)
+{
+	size_t index = getIndexOfGraphWithID(graph.getID());
+
+	std::unique_ptr<Graph> replacedGraph(graphs[index]);
+	graphs[index] = &graph;
+
+	return replacedGraph;
+}
+
 size_t GraphCollection::getIndexOfGraphWithID(const String& id) const
 {
 	size_t count = graphs.getCount();
@@ -108,9 +119,9 @@ Graph& GraphCollection::getGraphWithID(const String& id)
 
 std::unique_ptr<Iterator<Graph*>> GraphCollection::getIterator()
 {
-	CollectionIterator iterator = graphs.getIteratorToFirst();
+	typedef ConcreteIteratorAdapter<Graph*, CollectionIterator> ConcreteIterator;
 
-	return std::unique_ptr<Iterator<Graph*>>(new CollectionIterator(iterator));
+	return std::unique_ptr<Iterator<Graph*>>(new ConcreteIterator(graphs.getIterator()));
 }
 
 bool GraphCollection::isEmpty() const
@@ -8,7 +8,7 @@
 class GraphCollection
 {
 	typedef DynamicArray<Graph*> Collection;
-	typedef DynamicArray<Graph*>::DynamicArrayIterator<Graph*> CollectionIterator;
+	typedef Collection::Iterator CollectionIterator;
 
 public:
 	GraphCollection() = default;
@@ -20,6 +20,7 @@ public:
 
 	void add(Graph& graph);
 	std::unique_ptr<Graph> remove(const String& graphID);
+	std::unique_ptr<Graph> replace(Graph& graph);
 	Graph& getGraphWithID(const String& id);
 	
 	std::unique_ptr<Iterator<Graph*>> getIterator();
@@ -0,0 +1,20 @@
+#ifndef __SNAPSHOT_EXCEPTION_HEADER_INCLUDED__
+#define __SNAPSHOT_EXCEPTION_HEADER_INCLUDED__
+
+#include "../../Runtime Error/RuntimeError.h"
+
+class SnapshotException : public RuntimeError
+{
+public:
+	explicit SnapshotException(String errorMessage) :
+		RuntimeError(std::move(errorMessage))
+	{
+	}
+
+	explicit SnapshotException(const std::string& errorMessage) :
+		RuntimeError(errorMessage)
+	{
+	}
+};
+
+#endif //__SNAPSHOT_EXCEPTION_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,114 @@
+#ifndef __SNAPSHOT_FORMAT_HEADER_INCLUDED__
+#define __SNAPSHOT_FORMAT_HEADER_INCLUDED__
+
+#include <assert.h>
+#include <cstdint>
+#include <cstring>
+
+///
+/// The layout of a snapshot file, which holds the graphs of a collection
+/// in the byte order of the machine which saved them:
+///
+///   FileHeader
+///   for each graph:
+///     GraphHeader
+///     the characters of the id of the graph
+///     the offsets of the identifiers of the vertices, verticesCount + 1
+///       of them, and their characters
+///     the offsets of the edges leaving each vertex, verticesCount + 1 of
+///       them, then the index of the end and the weight of each edge
+///     if the graph has a contraction hierarchy:
+///       HierarchyHeader
+///       the rank of each vertex
+///       the offsets of the upward edges of each vertex, verticesCount + 1
+///         of them, then the upward edges as index, weight and middle
+///       the same for the downward edges
+///     the checksum of the graph, from its header on
+///
+/// Every part starts at a multiple of ALIGNMENT from the start of the file,
+/// so the offsets can be read in place. An undirected graph keeps each of
+/// its edges once, leaving the end with the smaller index. The vertices
+/// are stored in the order of their indices, which the edges and the
+/// hierarchy refer to.
+///
+namespace SnapshotFormat
+{
+	const char MAGIC[8] = { 'G', 'S', 'N', 'A', 'P', 'S', 'H', 'T' };
+	const std::uint32_t VERSION = 1;
+	const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+	const std::uint32_t IS_UNDIRECTED = 1;
+	const std::uint32_t IS_FROZEN = 2;
+	const std::uint32_t HAS_HIERARCHY = 4;
+	const size_t ALIGNMENT = 8;
+
+	struct FileHeader
+	{
+		char magic[8];
+		std::uint32_t version;
+		std::uint32_t byteOrderMark;
+		std::uint64_t graphsCount;
+	};
+
+	struct GraphHeader
+	{
+		std::uint32_t type;
+		std::uint32_t idLength;
+		std::uint64_t verticesCount;
+		std::uint64_t edgesCount;
+		std::uint64_t charactersCount;
+	};
+
+	struct HierarchyHeader
+	{
+		std::uint64_t upwardEdgesCount;
+		std::uint64_t downwardEdgesCount;
+	};
+
+	inline size_t getPaddedSize(size_t size)
+	{
+		return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+	}
+
+	///
+	/// A Fletcher checksum over 32-bit words, with the two sums kept modulo
+	/// 2^64. Unlike a plain sum, it changes when words are reordered, and it
+	/// takes two additions per word, so checking it costs far less than
+	/// reading the file.
+	///
+	class Checksum
+	{
+	public:
+		Checksum() :
+			sum(0),
+			sumOfSums(0)
+		{
+		}
+
+		void update(const void* data, size_t size)
+		{
+			assert(size % sizeof(std::uint32_t) == 0);
+
+			const char* bytes = static_cast<const char*>(data);
+			const char* end = bytes + size;
+			std::uint32_t word;
+
+			for (; bytes != end; bytes += sizeof(word))
+			{
+				memcpy(&word, bytes, sizeof(word));
+				sum += word;
+				sumOfSums += sum;
+			}
+		}
+
+		std::uint64_t getValue() const
+		{
+			return sumOfSums ^ (sum << 32) ^ (sum >> 32);
+		}
+
+	private:
+		std::uint64_t sum;
+		std::uint64_t sumOfSums;
+	};
+}
+
+#endif //__SNAPSHOT_FORMAT_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,397 @@
+#include "SnapshotReader.h"
+#include "../Snapshot Exception/SnapshotException.h"
+#include "../../File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include "../../Graph/Graph Exception/GraphException.h"
+#include "../../Graph/Directed Graph/DirectedGraph.h"
+#include "../../Graph/Undirected Graph/UndirectedGraph.h"
+#include "../../Graph/Static Graph/StaticGraph.h"
+#include <climits>
+
+SnapshotReader::SnapshotReader() :
+	current(nullptr),
+	end(nullptr)
+{
+}
+
+GraphCollection SnapshotReader::read(const String& fileName)
+{
+	openFile(fileName);
+
+	try
+	{
+		GraphCollection graphs;
+		std::uint64_t graphsCount = readFileHeader();
+
+		for (std::uint64_t i = 0; i < graphsCount; ++i)
+		{
+			std::unique_ptr<Graph> graph = readGraph();
+
+			graphs.add(*graph);
+			graph.release();
+		}
+
+		if (current != end)
+		{
+			failWith("The snapshot is corrupted: ");
+		}
+
+		clean();
+
+		return graphs;
+	}
+	catch (std::bad_alloc&)
+	{
+		clean();
+		throw SnapshotException(String("Not enough memory to restore the snapshot!"));
+	}
+	catch (...)
+	{
+		clean();
+		throw;
+	}
+}
+
+void SnapshotReader::openFile(const String& fileName)
+{
+	assert(!file.isOpened());
+
+	try
+	{
+		file.open(fileName);
+	}
+	catch (OpenFileFailException& e)
+	{
+		throw SnapshotException(String(e.what()));
+	}
+
+	this->fileName = fileName;
+	current = file.getContents();
+	end = current + file.getSize();
+}
+
+std::uint64_t SnapshotReader::readFileHeader()
+{
+	SnapshotFormat::FileHeader header;
+
+	if (static_cast<size_t>(end - current) < sizeof(header))
+	{
+		failWith("Not a snapshot file: ");
+	}
+
+	memcpy(&header, take(sizeof(header)), sizeof(header));
+
+	if (memcmp(header.magic, SnapshotFormat::MAGIC, sizeof(header.magic)) != 0)
+	{
+		failWith("Not a snapshot file: ");
+	}
+	else if (header.byteOrderMark != SnapshotFormat::BYTE_ORDER_MARK)
+	{
+		failWith("The snapshot was saved on a machine with another byte order: ");
+	}
+	else if (header.version != SnapshotFormat::VERSION)
+	{
+		failWith("Unsupported version of snapshot file: ");
+	}
+
+	return header.graphsCount;
+}
+
+///
+/// The parts of the graph are only located in the file until its checksum
+/// is verified, so that no memory is allocated for a corrupted graph.
+///
+std::unique_ptr<Graph> SnapshotReader::readGraph()
+{
+	const char* start = current;
+	SnapshotFormat::GraphHeader header = readGraphHeader();
+
+	const char* id = take(header.idLength);
+	const std::uint64_t* identifierOffsets = takeArray<std::uint64_t>(header.verticesCount + 1);
+	const char* characters = take(header.charactersCount);
+	const std::uint64_t* edgeOffsets = takeArray<std::uint64_t>(header.verticesCount + 1);
+	const std::uint32_t* targets = takeArray<std::uint32_t>(header.edgesCount);
+	const std::uint32_t* weights = takeArray<std::uint32_t>(header.edgesCount);
+
+	bool hasHierarchy = (header.type & SnapshotFormat::HAS_HIERARCHY) != 0;
+	HierarchyParts hierarchyParts = {};
+
+	if (hasHierarchy)
+	{
+		hierarchyParts = takeHierarchyParts(header.verticesCount);
+	}
+
+	verifyChecksumOfGraphStartingAt(start);
+	verifyOffsets(identifierOffsets, header.verticesCount, header.charactersCount);
+	verifyOffsets(edgeOffsets, header.verticesCount, header.edgesCount);
+
+	if (hasHierarchy)
+	{
+		verifyHierarchy(hierarchyParts, header.verticesCount);
+	}
+
+	size_t verticesCount = static_cast<size_t>(header.verticesCount);
+	collectIdentifiers(identifierOffsets, characters, verticesCount);
+	collectEdges(edgeOffsets, targets, weights, verticesCount);
+
+	std::unique_ptr<Graph> graph = loadGraph(header.type, String(id, header.idLength));
+
+	if (hasHierarchy)
+	{
+		restoreHierarchyOf(static_cast<StaticGraph&>(*graph), hierarchyParts);
+	}
+
+	return graph;
+}
+
+SnapshotFormat::GraphHeader SnapshotReader::readGraphHeader()
+{
+	SnapshotFormat::GraphHeader header;
+
+	memcpy(&header, take(sizeof(header)), sizeof(header));
+
+	const std::uint32_t ALL_FLAGS =
+		SnapshotFormat::IS_UNDIRECTED | SnapshotFormat::IS_FROZEN | SnapshotFormat::HAS_HIERARCHY;
+
+	if ((header.type & ~ALL_FLAGS) != 0
+		|| ((header.type & SnapshotFormat::HAS_HIERARCHY) && !(header.type & SnapshotFormat::IS_FROZEN))
+		|| header.verticesCount > UINT_MAX)
+	{
+		failWith("The snapshot is corrupted: ");
+	}
+
+	return header;
+}
+
+SnapshotReader::HierarchyParts SnapshotReader::takeHierarchyParts(std::uint64_t verticesCount)
+{
+	static_assert(sizeof(HierarchyEdge) == 3 * sizeof(std::uint32_t),
+				  "The edges of a hierarchy are stored as three 32-bit words");
+
+	SnapshotFormat::HierarchyHeader header;
+	memcpy(&header, take(sizeof(header)), sizeof(header));
+
+	HierarchyParts parts;
+	parts.upwardEdgesCount = header.upwardEdgesCount;
+	parts.downwardEdgesCount = header.downwardEdgesCount;
+	parts.ranks = takeArray<std::uint32_t>(verticesCount);
+	parts.upwardOffsets = takeArray<std::uint64_t>(verticesCount + 1);
+	parts.upwardEdges = takeArray<HierarchyEdge>(header.upwardEdgesCount);
+	parts.downwardOffsets = takeArray<std::uint64_t>(verticesCount + 1);
+	parts.downwardEdges = takeArray<HierarchyEdge>(header.downwardEdgesCount);
+
+	return parts;
+}
+
+void SnapshotReader::verifyChecksumOfGraphStartingAt(const char* start)
+{
+	SnapshotFormat::Checksum checksum;
+	checksum.update(start, current - start);
+
+	std::uint64_t savedChecksum;
+	memcpy(&savedChecksum, take(sizeof(savedChecksum)), sizeof(savedChecksum));
+
+	if (checksum.getValue() != savedChecksum)
+	{
+		failWith("The snapshot is corrupted: ");
+	}
+}
+
+///
+/// The checksum only catches damage to the file, so the offsets are still
+/// verified before they are used to index the arrays they point into.
+///
+void SnapshotReader::verifyOffsets(const std::uint64_t* offsets, std::uint64_t count, std::uint64_t last)
+{
+	for (std::uint64_t i = 0; i < count; ++i)
+	{
+		if (offsets[i] > offsets[i + 1])
+		{
+			throw SnapshotException(String("The offsets in the snapshot are not ordered!"));
+		}
+	}
+
+	if (offsets[0] != 0 || offsets[count] != last)
+	{
+		throw SnapshotException(String("The offsets in the snapshot do not match its counts!"));
+	}
+}
+
+///
+/// A query follows the indices in the hierarchy without checking them, so
+/// they must all lie within the graph.
+///
+void SnapshotReader::verifyHierarchy(const HierarchyParts& parts, std::uint64_t verticesCount)
+{
+	verifyOffsets(parts.upwardOffsets, verticesCount, parts.upwardEdgesCount);
+	verifyOffsets(parts.downwardOffsets, verticesCount, parts.downwardEdgesCount);
+
+	for (std::uint64_t i = 0; i < verticesCount; ++i)
+	{
+		if (parts.ranks[i] >= verticesCount)
+		{
+			throw SnapshotException(String("The contraction hierarchy in the snapshot is not valid!"));
+		}
+	}
+
+	verifyHierarchyEdges(parts.upwardEdges, parts.upwardEdgesCount, verticesCount);
+	verifyHierarchyEdges(parts.downwardEdges, parts.downwardEdgesCount, verticesCount);
+}
+
+void SnapshotReader::verifyHierarchyEdges(const HierarchyEdge* edges,
+										  std::uint64_t count,
+										  std::uint64_t verticesCount)
+{
+	for (std::uint64_t i = 0; i < count; ++i)
+	{
+		if (edges[i].vertexIndex >= verticesCount
+			|| (edges[i].middleIndex >= verticesCount
+				&& edges[i].middleIndex != ContractionHierarchy::NO_MIDDLE))
+		{
+			throw SnapshotException(String("The contraction hierarchy in the snapshot is not valid!"));
+		}
+	}
+}
+
+void SnapshotReader::collectIdentifiers(const std::uint64_t* offsets, const char* characters, size_t count)
+{
+	identifiers.ensureSize(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		size_t first = static_cast<size_t>(offsets[i]);
+		size_t length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+
+		identifiers.add(String(characters + first, length));
+	}
+}
+
+void SnapshotReader::collectEdges(const std::uint64_t* offsets,
+								  const std::uint32_t* targets,
+								  const std::uint32_t* weights,
+								  size_t verticesCount)
+{
+	edges.reserve(static_cast<size_t>(offsets[verticesCount]));
+
+	for (size_t start = 0; start < verticesCount; ++start)
+	{
+		size_t last = static_cast<size_t>(offsets[start + 1]);
+
+		for (size_t i = static_cast<size_t>(offsets[start]); i < last; ++i)
+		{
+			Graph::IndexedEdge edge;
+			edge.startIndex = static_cast<unsigned>(start);
+			edge.endIndex = targets[i];
+			edge.weight = weights[i];
+
+			edges.push_back(edge);
+		}
+	}
+}
+
+///
+/// A frozen graph is loaded into a graph of its kind first and then frozen
+/// the way FREEZE does it.
+///
+std::unique_ptr<Graph> SnapshotReader::loadGraph(std::uint32_t type, const String& id)
+{
+	std::unique_ptr<Graph> graph = createGraph(type, id);
+
+	try
+	{
+		graph->bulkLoad(identifiers, edges);
+
+		if (type & SnapshotFormat::IS_FROZEN)
+		{
+			graph = StaticGraph::createFrozenCopyOf(*graph);
+		}
+	}
+	catch (GraphException& e)
+	{
+		throw SnapshotException(e.what() + String("\nError in: ") + fileName);
+	}
+
+	identifiers.empty();
+	edges.clear();
+
+	return graph;
+}
+
+///
+/// The frozen graph keeps the indices of the vertices in the snapshot, so
+/// the hierarchy is restored as it was saved.
+///
+void SnapshotReader::restoreHierarchyOf(StaticGraph& graph, const HierarchyParts& parts)
+{
+	size_t verticesCount = graph.getVerticesCount();
+
+	std::unique_ptr<ContractionHierarchy> hierarchy(new ContractionHierarchy(graph,
+		ContractionHierarchy::RanksArray(parts.ranks, parts.ranks + verticesCount),
+		ContractionHierarchy::OffsetsArray(parts.upwardOffsets, parts.upwardOffsets + verticesCount + 1),
+		ContractionHierarchy::EdgesArray(parts.upwardEdges, parts.upwardEdges + parts.upwardEdgesCount),
+		ContractionHierarchy::OffsetsArray(parts.downwardOffsets, parts.downwardOffsets + verticesCount + 1),
+		ContractionHierarchy::EdgesArray(parts.downwardEdges, parts.downwardEdges + parts.downwardEdgesCount)));
+
+	graph.setContractionHierarchy(std::move(hierarchy));
+}
+
+std::unique_ptr<Graph> SnapshotReader::createGraph(std::uint32_t type, const String& id)
+{
+	if (type & SnapshotFormat::IS_UNDIRECTED)
+	{
+		return std::unique_ptr<Graph>(new UndirectedGraph(id));
+	}
+	else
+	{
+		return std::unique_ptr<Graph>(new DirectedGraph(id));
+	}
+}
+
+///
+/// Returns the next size characters of the file and skips them along with
+/// the padding after them.
+///
+const char* SnapshotReader::take(std::uint64_t size)
+{
+	std::uint64_t remainingSize = static_cast<std::uint64_t>(end - current);
+
+	if (size > remainingSize || SnapshotFormat::getPaddedSize(static_cast<size_t>(size)) > remainingSize)
+	{
+		failWith("The snapshot is truncated: ");
+	}
+
+	const char* taken = current;
+	current += SnapshotFormat::getPaddedSize(static_cast<size_t>(size));
+
+	return taken;
+}
+
+///
+/// Every part of the file starts at a multiple of the alignment and the
+/// file is mapped at the start of a page, so the array can be read in
+/// place.
+///
+template <class T>
+const T* SnapshotReader::takeArray(std::uint64_t count)
+{
+	if (count > static_cast<std::uint64_t>(end - current) / sizeof(T))
+	{
+		failWith("The snapshot is truncated: ");
+	}
+
+	return reinterpret_cast<const T*>(take(count * sizeof(T)));
+}
+
+void SnapshotReader::failWith(const char* message) const
+{
+	throw SnapshotException(message + fileName);
+}
+
+void SnapshotReader::clean()
+{
+	file.close();
+	current = nullptr;
+	end = nullptr;
+	identifiers.empty();
+	edges.clear();
+	edges.shrink_to_fit();
+}
\ No newline at end of file
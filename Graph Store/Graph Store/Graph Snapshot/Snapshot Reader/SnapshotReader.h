@@ -0,0 +1,78 @@
+#ifndef __SNAPSHOT_READER_HEADER_INCLUDED__
+#define __SNAPSHOT_READER_HEADER_INCLUDED__
+
+#include "../Snapshot Format/SnapshotFormat.h"
+#include "../../Graph Collection/GraphCollection.h"
+#include "../../Mapped File/MappedFile.h"
+#include "../../Shortest Path Algorithms/Contraction Hierarchy/ContractionHierarchy.h"
+
+///
+/// Reads the graphs of a snapshot file (see SnapshotFormat) into a new
+/// collection. The file is mapped into memory and its arrays are read in
+/// place, and each graph is loaded in bulk once its checksum is verified,
+/// so reading takes time linear in the size of the file.
+///
+/// Either all of the graphs are read or an exception is thrown.
+///
+class SnapshotReader
+{
+	typedef ContractionHierarchy::HierarchyEdge HierarchyEdge;
+
+	struct HierarchyParts
+	{
+		const std::uint32_t* ranks;
+		const std::uint64_t* upwardOffsets;
+		const HierarchyEdge* upwardEdges;
+		const std::uint64_t* downwardOffsets;
+		const HierarchyEdge* downwardEdges;
+		std::uint64_t upwardEdgesCount;
+		std::uint64_t downwardEdgesCount;
+	};
+
+public:
+	SnapshotReader();
+	SnapshotReader(const SnapshotReader&) = delete;
+	SnapshotReader& operator=(const SnapshotReader&) = delete;
+	SnapshotReader(SnapshotReader&&) = delete;
+	SnapshotReader& operator=(SnapshotReader&&) = delete;
+	~SnapshotReader() = default;
+
+	GraphCollection read(const String& fileName);
+
+private:
+	static std::unique_ptr<Graph> createGraph(std::uint32_t type, const String& id);
+	static void verifyOffsets(const std::uint64_t* offsets, std::uint64_t count, std::uint64_t last);
+	static void verifyHierarchy(const HierarchyParts& parts, std::uint64_t verticesCount);
+	static void verifyHierarchyEdges(const HierarchyEdge* edges, std::uint64_t count, std::uint64_t verticesCount);
+	static void restoreHierarchyOf(StaticGraph& graph, const HierarchyParts& parts);
+
+private:
+	void openFile(const String& fileName);
+	std::uint64_t readFileHeader();
+	std::unique_ptr<Graph> readGraph();
+	SnapshotFormat::GraphHeader readGraphHeader();
+	HierarchyParts takeHierarchyParts(std::uint64_t verticesCount);
+	void verifyChecksumOfGraphStartingAt(const char* start);
+	void collectIdentifiers(const std::uint64_t* offsets, const char* characters, size_t count);
+	void collectEdges(const std::uint64_t* offsets,
+					  const std::uint32_t* targets,
+					  const std::uint32_t* weights,
+					  size_t verticesCount);
+	std::unique_ptr<Graph> loadGraph(std::uint32_t type, const String& id);
+	const char* take(std::uint64_t size);
+	void failWith(const char* message) const;
+	void clean();
+
+	template <class T>
+	const T* takeArray(std::uint64_t count);
+
+private:
+	MappedFile file;
+	String fileName;
+	const char* current;
+	const char* end;
+	DynamicArray<String> identifiers;
+	Graph::IndexedEdgesArray edges;
+};
+
+#endif //__SNAPSHOT_READER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,331 @@
+#include "SnapshotWriter.h"
+#include "../Snapshot Exception/SnapshotException.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include <cstdio>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+const char SnapshotWriter::TEMPORARY_FILE_SUFFIX[] = ".tmp";
+
+///
+/// The snapshot is written to a temporary file next to the given one, which
+/// replaces it only once the snapshot is written whole. So a failed save
+/// leaves the previous snapshot in place and removes only its own file.
+///
+void SnapshotWriter::write(GraphCollection& graphs, const String& fileName)
+{
+	String temporaryFileName = fileName + TEMPORARY_FILE_SUFFIX;
+
+	openFile(temporaryFileName);
+
+	try
+	{
+		writeGraphs(graphs);
+		file.close();
+	}
+	catch (std::bad_alloc&)
+	{
+		discardFile(temporaryFileName);
+		throw SnapshotException(String("Not enough memory to save the snapshot!"));
+	}
+	catch (...)
+	{
+		discardFile(temporaryFileName);
+		throw;
+	}
+
+	if (file.fail())
+	{
+		discardFile(temporaryFileName);
+		throw SnapshotException("Could not write the snapshot to file, name: " + fileName);
+	}
+
+	clean();
+	replaceFile(fileName, temporaryFileName);
+}
+
+void SnapshotWriter::replaceFile(const String& fileName, const String& temporaryFileName)
+{
+	if (!moveFile(temporaryFileName, fileName))
+	{
+		std::remove(temporaryFileName.cString());
+		throw SnapshotException("Could not write the snapshot to file, name: " + fileName);
+	}
+}
+
+///
+/// std::rename does not replace an existing file on Windows.
+///
+bool SnapshotWriter::moveFile(const String& source, const String& target)
+{
+#ifdef _WIN32
+	return MoveFileExA(source.cString(), target.cString(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+	return std::rename(source.cString(), target.cString()) == 0;
+#endif
+}
+
+void SnapshotWriter::discardFile(const String& fileName)
+{
+	clean();
+	std::remove(fileName.cString());
+}
+
+void SnapshotWriter::openFile(const String& fileName)
+{
+	assert(!file.is_open());
+
+	file.open(fileName.cString(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+	if (!file)
+	{
+		file.clear();
+		throw SnapshotException("Could not open file for writing, name: " + fileName);
+	}
+}
+
+void SnapshotWriter::writeGraphs(GraphCollection& graphs)
+{
+	SnapshotFormat::FileHeader header;
+
+	memcpy(header.magic, SnapshotFormat::MAGIC, sizeof(header.magic));
+	header.version = SnapshotFormat::VERSION;
+	header.byteOrderMark = SnapshotFormat::BYTE_ORDER_MARK;
+	header.graphsCount = graphs.getCount();
+
+	writeBytes(&header, sizeof(header));
+
+	forEach(*graphs.getIterator(), [&](Graph* graph)
+	{
+		writeGraph(*graph);
+	});
+}
+
+void SnapshotWriter::writeGraph(const Graph& graph)
+{
+	checksum = SnapshotFormat::Checksum();
+
+	collectIdentifiersOf(graph);
+	collectEdgesOf(graph);
+
+	writeHeaderOf(graph);
+	writePadded(graph.getID().cString(), graph.getID().getLength());
+	writePadded(identifierOffsets);
+	writePadded(characters);
+	writePadded(edgeOffsets);
+	writePadded(targets);
+	writePadded(weights);
+
+	const ContractionHierarchy* hierarchy = getHierarchyOf(graph);
+
+	if (hierarchy != nullptr)
+	{
+		writeHierarchy(*hierarchy);
+	}
+
+	writeChecksum();
+}
+
+void SnapshotWriter::collectIdentifiersOf(const Graph& graph)
+{
+	vertices.assign(graph.getVerticesCount(), nullptr);
+
+	forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+	{
+		assert(v->getIndex() < vertices.size());
+
+		vertices[v->getIndex()] = v;
+	});
+
+	identifierOffsets.assign(1, 0);
+	characters.clear();
+
+	for (const Vertex* v : vertices)
+	{
+		const String& id = v->getID();
+
+		characters.insert(characters.end(), id.cString(), id.cString() + id.getLength());
+		identifierOffsets.push_back(characters.size());
+	}
+}
+
+void SnapshotWriter::collectEdgesOf(const Graph& graph)
+{
+	bool isUndirected = !graph.isDirected();
+
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		collectEdgesOf(concreteGraph, isUndirected);
+	});
+}
+
+///
+/// An undirected edge is found leaving both of its ends, so only the time
+/// it leaves the end with the smaller index is kept. A loop is found twice
+/// leaving its vertex, so only the first time is kept.
+///
+template <class ConcreteGraph>
+void SnapshotWriter::collectEdgesOf(const ConcreteGraph& graph, bool isUndirected)
+{
+	edgeOffsets.assign(1, 0);
+	targets.clear();
+	weights.clear();
+
+	for (const Vertex* start : vertices)
+	{
+		size_t startIndex = start->getIndex();
+		bool keepsLoop = true;
+
+		graph.forEachEdgeLeaving(*start, [&](const Edge& e)
+		{
+			size_t endIndex = e.getVertex().getIndex();
+			bool isKept = !isUndirected || startIndex < endIndex;
+
+			if (isUndirected && startIndex == endIndex)
+			{
+				isKept = keepsLoop;
+				keepsLoop = !keepsLoop;
+			}
+
+			if (isKept)
+			{
+				targets.push_back(static_cast<std::uint32_t>(endIndex));
+				weights.push_back(e.getWeight());
+			}
+		});
+
+		edgeOffsets.push_back(targets.size());
+	}
+}
+
+std::uint32_t SnapshotWriter::getTypeOf(const Graph& graph)
+{
+	std::uint32_t type = 0;
+
+	if (!graph.isDirected())
+	{
+		type |= SnapshotFormat::IS_UNDIRECTED;
+	}
+
+	if (dynamic_cast<const StaticGraph*>(&graph) != nullptr)
+	{
+		type |= SnapshotFormat::IS_FROZEN;
+	}
+
+	if (getHierarchyOf(graph) != nullptr)
+	{
+		type |= SnapshotFormat::HAS_HIERARCHY;
+	}
+
+	return type;
+}
+
+const ContractionHierarchy* SnapshotWriter::getHierarchyOf(const Graph& graph)
+{
+	const StaticGraph* staticGraph = dynamic_cast<const StaticGraph*>(&graph);
+
+	return (staticGraph != nullptr) ? staticGraph->getContractionHierarchy() : nullptr;
+}
+
+void SnapshotWriter::writeHeaderOf(const Graph& graph)
+{
+	SnapshotFormat::GraphHeader header;
+
+	header.type = getTypeOf(graph);
+	header.idLength = static_cast<std::uint32_t>(graph.getID().getLength());
+	header.verticesCount = vertices.size();
+	header.edgesCount = targets.size();
+	header.charactersCount = characters.size();
+
+	writePadded(&header, sizeof(header));
+}
+
+///
+/// The hierarchy refers to the vertices by index, and they are written in
+/// the order of their indices.
+///
+void SnapshotWriter::writeHierarchy(const ContractionHierarchy& hierarchy)
+{
+	SnapshotFormat::HierarchyHeader header;
+
+	header.upwardEdgesCount = hierarchy.upwardEdges.size();
+	header.downwardEdgesCount = hierarchy.downwardEdges.size();
+
+	writePadded(&header, sizeof(header));
+	writePadded(hierarchy.ranks);
+	writeOffsets(hierarchy.upwardOffsets);
+	writePadded(hierarchy.upwardEdges);
+	writeOffsets(hierarchy.downwardOffsets);
+	writePadded(hierarchy.downwardEdges);
+}
+
+void SnapshotWriter::writeOffsets(const std::vector<size_t>& offsets)
+{
+	hierarchyOffsets.assign(offsets.cbegin(), offsets.cend());
+	writePadded(hierarchyOffsets);
+}
+
+template <class T>
+void SnapshotWriter::writePadded(const std::vector<T>& items)
+{
+	writePadded(items.data(), items.size() * sizeof(T));
+}
+
+///
+/// The checksum covers the padding as well, so that the reader can check
+/// each part of a graph as it lies in the file.
+///
+void SnapshotWriter::writePadded(const void* data, size_t size)
+{
+	static const char PADDING[SnapshotFormat::ALIGNMENT] = {};
+
+	size_t paddedSize = SnapshotFormat::getPaddedSize(size);
+	size_t checkedSize = size - size % sizeof(std::uint32_t);
+
+	writeBytes(data, size);
+	writeBytes(PADDING, paddedSize - size);
+
+	checksum.update(data, checkedSize);
+
+	if (checkedSize != size)
+	{
+		char lastWord[sizeof(std::uint32_t)] = {};
+		memcpy(lastWord, static_cast<const char*>(data) + checkedSize, size - checkedSize);
+
+		checksum.update(lastWord, sizeof(lastWord));
+		checkedSize += sizeof(lastWord);
+	}
+
+	checksum.update(PADDING, paddedSize - checkedSize);
+}
+
+void SnapshotWriter::writeChecksum()
+{
+	std::uint64_t value = checksum.getValue();
+
+	writeBytes(&value, sizeof(value));
+}
+
+void SnapshotWriter::writeBytes(const void* data, size_t size)
+{
+	file.write(static_cast<const char*>(data), size);
+}
+
+void SnapshotWriter::clean()
+{
+	if (file.is_open())
+	{
+		file.close();
+	}
+
+	file.clear();
+	vertices.clear();
+	identifierOffsets.clear();
+	characters.clear();
+	edgeOffsets.clear();
+	targets.clear();
+	weights.clear();
+	hierarchyOffsets.clear();
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#ifndef __SNAPSHOT_WRITER_HEADER_INCLUDED__
+#define __SNAPSHOT_WRITER_HEADER_INCLUDED__
+
+#include "../Snapshot Format/SnapshotFormat.h"
+#include "../../Graph Collection/GraphCollection.h"
+#include "../../Shortest Path Algorithms/Contraction Hierarchy/ContractionHierarchy.h"
+#include <fstream>
+#include <vector>
+
+///
+/// Writes the graphs of a collection to a snapshot file (see
+/// SnapshotFormat), along with the contraction hierarchies of the frozen
+/// ones, which take long to build. The landmarks, the all pairs shortest
+/// paths and the watched sources of the graphs are not written, since they
+/// can be computed again from the graphs.
+///
+class SnapshotWriter
+{
+public:
+	SnapshotWriter() = default;
+	SnapshotWriter(const SnapshotWriter&) = delete;
+	SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+	SnapshotWriter(SnapshotWriter&&) = delete;
+	SnapshotWriter& operator=(SnapshotWriter&&) = delete;
+	~SnapshotWriter() = default;
+
+	void write(GraphCollection& graphs, const String& fileName);
+
+private:
+	static const char TEMPORARY_FILE_SUFFIX[];
+
+private:
+	static bool moveFile(const String& source, const String& target);
+	static std::uint32_t getTypeOf(const Graph& graph);
+	static const ContractionHierarchy* getHierarchyOf(const Graph& graph);
+
+private:
+	void openFile(const String& fileName);
+	void writeGraphs(GraphCollection& graphs);
+	void writeGraph(const Graph& graph);
+	void collectIdentifiersOf(const Graph& graph);
+	void collectEdgesOf(const Graph& graph);
+	void writeHeaderOf(const Graph& graph);
+	void writeHierarchy(const ContractionHierarchy& hierarchy);
+	void writeOffsets(const std::vector<size_t>& offsets);
+	void writeChecksum();
+	void writePadded(const void* data, size_t size);
+	void writeBytes(const void* data, size_t size);
+	void replaceFile(const String& fileName, const String& temporaryFileName);
+	void discardFile(const String& fileName);
+	void clean();
+
+	template <class ConcreteGraph>
+	void collectEdgesOf(const ConcreteGraph& graph, bool isUndirected);
+
+	template <class T>
+	void writePadded(const std::vector<T>& items);
+
+private:
+	std::ofstream file;
+	SnapshotFormat::Checksum checksum;
+	std::vector<const Vertex*> vertices;
+	std::vector<std::uint64_t> identifierOffsets;
+	std::vector<char> characters;
+	std::vector<std::uint64_t> edgeOffsets;
+	std::vector<std::uint32_t> targets;
+	std::vector<std::uint32_t> weights;
+	std::vector<std::uint64_t> hierarchyOffsets;
+};
+
+#endif //__SNAPSHOT_WRITER_HEADER_INCLUDED__
\ No newline at end of file
@@ -1,11 +1,22 @@
 #include "Graph.h"
 #include "../Graph Exception/GraphException.h"
+#include "../../Shortest Path Algorithms/Landmarks/Landmarks.h"
+#include "../../Shortest Path Algorithms/All Pairs Shortest Paths/AllPairsShortestPaths.h"
+#include "../../Shortest Path Algorithms/Dynamic Shortest Path Tree/DynamicShortestPathTree.h"
+#include <algorithm>
 
-Graph::Graph(const String& id)
+std::atomic<std::uint64_t> Graph::lastVersion(0);
+
+Graph::Graph(const String& id) :
+	version(generateVersion())
 {
 	setID(id);
 }
 
+Graph::~Graph()
+{
+}
+
 void Graph::setID(String id)
 {
 	if (id != String(""))
@@ -22,3 +33,138 @@ const String& Graph::getID() const
 {
 	return id;
 }
+
+
+const Landmarks* Graph::getLandmarks() const
+{
+	return landmarks.get();
+}
+
+///
+/// The distances to and from the landmarks are only valid for the graph
+/// they were measured on, so every modification of the graph discards them.
+///
+void Graph::setLandmarks(std::unique_ptr<Landmarks> landmarks)
+{
+	this->landmarks = std::move(landmarks);
+}
+
+const AllPairsShortestPaths* Graph::getAllPairsShortestPaths() const
+{
+	return allPairsShortestPaths.get();
+}
+
+///
+/// Discarded on every modification of the graph, like the landmarks.
+///
+void Graph::setAllPairsShortestPaths(std::unique_ptr<AllPairsShortestPaths> paths)
+{
+	allPairsShortestPaths = std::move(paths);
+}
+
+///
+/// Unlike the landmarks, the tree of a watched source outlives the
+/// modifications of the graph: the graphs repair it after each edge they
+/// add or remove.
+///
+void Graph::watchSource(const Vertex& source)
+{
+	if (getWatchedTreeOf(source) == nullptr)
+	{
+		watchedTrees.emplace_back(new DynamicShortestPathTree(*this, source));
+	}
+}
+
+void Graph::stopWatching(const Vertex& source)
+{
+	watchedTrees.erase(std::remove_if(watchedTrees.begin(), watchedTrees.end(),
+									  [&](const std::unique_ptr<DynamicShortestPathTree>& tree)
+									  {
+										  return &tree->getSource() == &source;
+									  }),
+					   watchedTrees.end());
+}
+
+const DynamicShortestPathTree* Graph::getWatchedTreeOf(const Vertex& source) const
+{
+	for (const std::unique_ptr<DynamicShortestPathTree>& tree : watchedTrees)
+	{
+		if (&tree->getSource() == &source)
+		{
+			return tree.get();
+		}
+	}
+
+	return nullptr;
+}
+
+///
+/// A tree which cannot be repaired for lack of memory is no longer
+/// correct, so all the watches are dropped and the searches fall back to
+/// the algorithms.
+///
+void Graph::repairWatchedTreesAfterAdding(const Vertex& start, const Vertex& end, unsigned weight)
+{
+	try
+	{
+		for (std::unique_ptr<DynamicShortestPathTree>& tree : watchedTrees)
+		{
+			tree->repairAfterAdding(*this, start, end, weight);
+		}
+	}
+	catch (std::bad_alloc&)
+	{
+		watchedTrees.clear();
+	}
+}
+
+void Graph::repairWatchedTreesAfterRemoving(const Vertex& start, const Vertex& end)
+{
+	try
+	{
+		for (std::unique_ptr<DynamicShortestPathTree>& tree : watchedTrees)
+		{
+			tree->repairAfterRemoving(*this, start, end);
+		}
+	}
+	catch (std::bad_alloc&)
+	{
+		watchedTrees.clear();
+	}
+}
+
+void Graph::rebuildWatchedTrees()
+{
+	try
+	{
+		for (std::unique_ptr<DynamicShortestPathTree>& tree : watchedTrees)
+		{
+			tree->rebuild(*this);
+		}
+	}
+	catch (std::bad_alloc&)
+	{
+		watchedTrees.clear();
+	}
+}
+
+///
+/// The versions are unique among all graphs, so a graph and its version
+/// identify its contents even after another graph takes its address.
+///
+std::uint64_t Graph::getVersion() const
+{
+	return version;
+}
+
+std::uint64_t Graph::generateVersion()
+{
+	return ++lastVersion;
+}
+
+void Graph::markAsModified()
+{
+	version = generateVersion();
+	landmarks.reset();
+	allPairsShortestPaths.reset();
+}
\ No newline at end of file
@@ -2,10 +2,18 @@
 #define __GRAPH_HEADER_INCLUDED__
 
 #include "../../String/String.h"
+#include "../../Dynamic Array/DynamicArray.h"
 #include "../../Iterator/Iterator.h"
 #include "../Vertex/Vertex.h"
 #include "../Edge/Edge.h"
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <vector>
+
+class Landmarks;
+class AllPairsShortestPaths;
+class DynamicShortestPathTree;
 
 class Graph
 {
@@ -13,29 +21,71 @@ public:
 	typedef std::unique_ptr<ConstIterator<const Vertex*>> VerticesConstIterator;
 	typedef std::unique_ptr<ConstIterator<Edge>> EdgesConstIterator;
 
+	///
+	/// An edge between the vertices at two positions of the identifiers
+	/// passed to bulkLoad.
+	///
+	struct IndexedEdge
+	{
+		unsigned startIndex;
+		unsigned endIndex;
+		unsigned weight;
+	};
+
+	typedef std::vector<IndexedEdge> IndexedEdgesArray;
+
 public:
-	virtual ~Graph() = default;
+	virtual ~Graph();
 
 	virtual void addVertex(const String& id) = 0;
 	virtual void removeVertex(Vertex& v) = 0;
 	virtual void addEdge(Vertex& start, Vertex& end, unsigned weight) = 0;
 	virtual void removeEdge(Vertex& start, Vertex& end) = 0;
+	virtual void bulkLoad(const DynamicArray<String>& identifiers, const IndexedEdgesArray& edges) = 0;
 
 	virtual Vertex& getVertexWithID(const String& id) = 0;
 	virtual VerticesConstIterator getConstIteratorOfVertices() const = 0;
 	virtual EdgesConstIterator getConstIteratorOfEdgesLeaving(const Vertex& v) const = 0;
+	virtual EdgesConstIterator getConstIteratorOfEdgesEntering(const Vertex& v) const = 0;
 	virtual unsigned getVerticesCount() const = 0;
+	virtual bool isDirected() const = 0;
 
 	const String& getID() const;
 	void setID(String id);
+	std::uint64_t getVersion() const;
+	const Landmarks* getLandmarks() const;
+	void setLandmarks(std::unique_ptr<Landmarks> landmarks);
+	const AllPairsShortestPaths* getAllPairsShortestPaths() const;
+	void setAllPairsShortestPaths(std::unique_ptr<AllPairsShortestPaths> paths);
+	void watchSource(const Vertex& source);
+	void stopWatching(const Vertex& source);
+	const DynamicShortestPathTree* getWatchedTreeOf(const Vertex& source) const;
 
 protected:
 	Graph(const String& id);
-	Graph(const Graph&) = default;
-	Graph& operator=(const Graph&) = default;
+	Graph(const Graph&) = delete;
+	Graph& operator=(const Graph&) = delete;
+
+	void markAsModified();
+	void repairWatchedTreesAfterAdding(const Vertex& start, const Vertex& end, unsigned weight);
+	void repairWatchedTreesAfterRemoving(const Vertex& start, const Vertex& end);
+	void rebuildWatchedTrees();
+
+private:
+	typedef std::vector<std::unique_ptr<DynamicShortestPathTree>> TreesArray;
+
+private:
+	static std::uint64_t generateVersion();
+
+private:
+	static std::atomic<std::uint64_t> lastVersion;
 
 private:
 	String id;
+	std::uint64_t version;
+	std::unique_ptr<Landmarks> landmarks;
+	std::unique_ptr<AllPairsShortestPaths> allPairsShortestPaths;
+	TreesArray watchedTrees;
 };
 
 #endif //__GRAPH_HEADER_INCLUDED__
\ No newline at end of file
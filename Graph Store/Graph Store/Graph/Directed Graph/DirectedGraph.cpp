@@ -5,7 +5,7 @@
 static GraphRegistrator<DirectedGraph> registrator("directed");
 
 DirectedGraph::DirectedGraph(const String& id) :
-	GraphBase(id)
+	GraphBase(id, true)
 {
 }
 
@@ -17,6 +17,7 @@ void DirectedGraph::addEdge(Vertex& start, Vertex& end, unsigned weight)
 	if (!hasEdgeFromTo(start, end))
 	{
 		addEdgeFromTo(start, end, weight);
+		repairWatchedTreesAfterAdding(start, end, weight);
 	}
 	else
 	{
@@ -30,23 +31,17 @@ void DirectedGraph::removeEdge(Vertex& start, Vertex& end)
 	verifyOwnershipOf(end);
 
 	removeEdgeFromTo(start, end);
+	repairWatchedTreesAfterRemoving(start, end);
+}
+
+bool DirectedGraph::isDirected() const
+{
+	return true;
 }
 
 void DirectedGraph::removeEdgesEndingIn(Vertex& end)
 {
 	assert(isOwnerOf(end));
 
-	VerticesConcreteIterator iterator = getConcreteIteratorOfVertices();
-
-	forEach(iterator, [&](Vertex* start)
-	{
-		try
-		{
-			removeEdgeFromTo(*start, end);
-		}
-		catch (GraphException&)
-		{
-			//Ok, there is no such edge.
-		}
-	});
+	removeEdgesEntering(end);
 }
@@ -10,6 +10,10 @@ public:
 
 	virtual void addEdge(Vertex& start, Vertex& end, unsigned weight) override;
 	virtual void removeEdge(Vertex& start, Vertex& end) override;
+	virtual bool isDirected() const override;
+
+	using GraphBase::forEachEdgeLeaving;
+	using GraphBase::forEachEdgeEntering;
 
 protected:
 	virtual void removeEdgesEndingIn(Vertex& v) override;
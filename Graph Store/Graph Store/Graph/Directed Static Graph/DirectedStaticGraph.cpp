@@ -0,0 +1,11 @@
+#include "DirectedStaticGraph.h"
+
+DirectedStaticGraph::DirectedStaticGraph(const String& id) :
+	StaticGraph(id)
+{
+}
+
+bool DirectedStaticGraph::isDirected() const
+{
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#ifndef __DIRECTED_STATIC_GRAPH_HEADER_INCLUDED__
+#define __DIRECTED_STATIC_GRAPH_HEADER_INCLUDED__
+
+#include "../Static Graph/StaticGraph.h"
+
+class DirectedStaticGraph : public StaticGraph
+{
+public:
+	explicit DirectedStaticGraph(const String& id);
+
+	virtual bool isDirected() const override;
+};
+
+#endif //__DIRECTED_STATIC_GRAPH_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include "EdgeList.h"
+#include "../Vertex/Vertex.h"
+#include "../../Iterator/Iterator.h"
+
+EdgeList::EdgeList(BoxAllocator& allocator) :
+	first(nullptr),
+	count(0),
+	allocator(allocator)
+{
+}
+
+void EdgeList::add(const Edge& e)
+{
+	addFront(e);
+
+	if (isIndexed())
+	{
+		addToIndex(first->edge);
+	}
+	else if (count > INDEXING_THRESHOLD)
+	{
+		buildIndex(count);
+	}
+}
+
+bool EdgeList::removeEdgeTo(const Vertex& end)
+{
+	Edge* edge = searchForEdgeTo(end);
+
+	if (edge != nullptr)
+	{
+		remove(*edge);
+
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+void EdgeList::addFront(const Edge& e)
+{
+	Box* newBox = allocator.allocate();
+	first = new (newBox) Box(e, first);
+	++count;
+}
+
+void EdgeList::removeFirst()
+{
+	assert(first != nullptr);
+
+	Box* oldFirst = first;
+	first = first->next;
+	--count;
+
+	oldFirst->~Box();
+	allocator.release(oldFirst);
+}
+
+///
+/// Only the first box of the list can be unlinked in constant time, so
+/// the removed edge is overwritten with the first edge and the first box
+/// is released instead.
+///
+void EdgeList::remove(Edge& edge)
+{
+	Edge& firstEdge = first->edge;
+	bool isFirst = (&edge == &firstEdge);
+
+	removeFromIndex(edge.getVertex());
+
+	if (!isFirst)
+	{
+		removeFromIndex(firstEdge.getVertex());
+		edge = firstEdge;
+	}
+
+	removeFirst();
+
+	if (count <= INDEXING_THRESHOLD / 2)
+	{
+		index.reset();
+	}
+	else if (!isFirst)
+	{
+		addToIndex(edge);
+	}
+}
+
+Edge* EdgeList::searchForEdgeTo(const Vertex& end)
+{
+	if (isIndexed())
+	{
+		return index->search(&end);
+	}
+
+	Iterator iterator = getIterator();
+
+	while (iterator)
+	{
+		if (iterator->getVertex() == end)
+		{
+			return &(*iterator);
+		}
+
+		++iterator;
+	}
+
+	return nullptr;
+}
+
+const Edge* EdgeList::searchForEdgeTo(const Vertex& end) const
+{
+	if (isIndexed())
+	{
+		const Index& constIndex = *index;
+
+		return constIndex.search(&end);
+	}
+
+	ConstIterator iterator = getConstIterator();
+
+	while (iterator)
+	{
+		if (iterator->getVertex() == end)
+		{
+			return &(*iterator);
+		}
+
+		++iterator;
+	}
+
+	return nullptr;
+}
+
+bool EdgeList::hasEdgeTo(const Vertex& end) const
+{
+	return searchForEdgeTo(end) != nullptr;
+}
+
+void EdgeList::empty()
+{
+	index.reset();
+
+	while (first != nullptr)
+	{
+		removeFirst();
+	}
+}
+
+///
+/// The index only speeds up searches, so if there is not enough memory
+/// to keep it up to date, the list goes on without it.
+///
+void EdgeList::addToIndex(Edge& e)
+{
+	if (!isIndexed())
+	{
+		return;
+	}
+
+	try
+	{
+		index->add(e);
+	}
+	catch (std::bad_alloc&)
+	{
+		index.reset();
+	}
+}
+
+void EdgeList::removeFromIndex(const Vertex& end)
+{
+	if (!isIndexed())
+	{
+		return;
+	}
+
+	try
+	{
+		index->remove(&end);
+	}
+	catch (std::bad_alloc&)
+	{
+		index.reset();
+	}
+}
+
+///
+/// A list which is going to hold more than INDEXING_THRESHOLD edges gets
+/// its index right away, sized for all of them, instead of building it on
+/// the way and growing it.
+///
+void EdgeList::reserve(size_t count)
+{
+	if (count > INDEXING_THRESHOLD && !isIndexed())
+	{
+		buildIndex(count);
+	}
+}
+
+void EdgeList::buildIndex(size_t expectedCount)
+{
+	try
+	{
+		std::unique_ptr<Index> newIndex(new Index(expectedCount));
+		Iterator iterator = getIterator();
+
+		forEach(iterator, [&](Edge& e)
+		{
+			newIndex->add(e);
+		});
+
+		index = std::move(newIndex);
+	}
+	catch (std::bad_alloc&)
+	{
+		//The list is searched linearly until the next attempt.
+	}
+}
+
+bool EdgeList::isIndexed() const
+{
+	return index != nullptr;
+}
+
+size_t EdgeList::getCount() const
+{
+	return count;
+}
+
+EdgeList::Iterator EdgeList::getIterator()
+{
+	return Iterator(first);
+}
+
+EdgeList::ConstIterator EdgeList::getConstIterator() const
+{
+	return ConstIterator(first);
+}
\ No newline at end of file
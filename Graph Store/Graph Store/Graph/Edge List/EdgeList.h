@@ -0,0 +1,168 @@
+#ifndef __EDGE_LIST_HEADER_INCLUDED__
+#define __EDGE_LIST_HEADER_INCLUDED__
+
+#include "../../Hash/Hash.h"
+#include "../../Hash/Hash Function/HashFunctionPointerSpecialization.h"
+#include "../../Slab Allocator/SlabAllocator.h"
+#include "../Edge/Edge.h"
+#include <type_traits>
+#include <stdexcept>
+#include <memory>
+
+///
+/// The edges adjacent to a vertex, at most one per vertex at their other end.
+///
+/// The edges are kept in a singly linked list whose boxes come from the
+/// slab allocator of the graph. The boxes belong to the allocator, so the
+/// list does not release them when it is destroyed: the graph empties
+/// the lists of a vertex it removes and frees all the boxes at once when
+/// it is destroyed.
+///
+/// Short lists are searched linearly. When a list grows longer than
+/// INDEXING_THRESHOLD, an index from the vertex at the other end of each
+/// edge to the edge is built, so searches, additions and removals take
+/// expected constant time for high-degree vertices too. The index is
+/// dropped again once the list shrinks to half the threshold.
+///
+class EdgeList
+{
+	struct Box
+	{
+		Box(const Edge& edge, Box* next) :
+			edge(edge),
+			next(next)
+		{
+		}
+
+		Edge edge;
+		Box* next;
+	};
+
+	class EndOfEdgeAccessor
+	{
+	public:
+		const Vertex* operator()(const Edge& e) const
+		{
+			return &e.getVertex();
+		}
+	};
+
+	typedef Hash<Edge, const Vertex*, EndOfEdgeAccessor> Index;
+
+public:
+	template <bool isConst>
+	class EdgeListIterator
+	{
+		friend class EdgeList;
+		template <bool> friend class EdgeListIterator;
+		typedef typename std::conditional<isConst, const Box*, Box*>::type BoxPointer;
+
+	public:
+		typedef typename std::conditional<isConst, const Edge&, Edge&>::type Reference;
+		typedef typename std::conditional<isConst, const Edge*, Edge*>::type Pointer;
+
+	public:
+		EdgeListIterator(const EdgeListIterator<false>& source) :
+			current(source.current)
+		{
+		}
+
+		EdgeListIterator<isConst>& operator++()
+		{
+			if (isValid())
+			{
+				current = current->next;
+			}
+
+			return *this;
+		}
+
+		Reference operator*() const
+		{
+			return getCurrentItem();
+		}
+
+		Pointer operator->() const
+		{
+			return &getCurrentItem();
+		}
+
+		bool operator!() const
+		{
+			return !isValid();
+		}
+
+		operator bool() const
+		{
+			return isValid();
+		}
+
+	private:
+		EdgeListIterator(BoxPointer current) :
+			current(current)
+		{
+		}
+
+		Reference getCurrentItem() const
+		{
+			if (isValid())
+			{
+				return current->edge;
+			}
+			else
+			{
+				throw std::out_of_range("Iterator out of range!");
+			}
+		}
+
+		bool isValid() const
+		{
+			return current != nullptr;
+		}
+
+	private:
+		BoxPointer current;
+	};
+
+	typedef EdgeListIterator<false> Iterator;
+	typedef EdgeListIterator<true> ConstIterator;
+	typedef SlabAllocator<Box> BoxAllocator;
+
+public:
+	explicit EdgeList(BoxAllocator& allocator);
+	EdgeList(const EdgeList&) = delete;
+	EdgeList& operator=(const EdgeList&) = delete;
+	~EdgeList() = default;
+
+	void add(const Edge& e);
+	bool removeEdgeTo(const Vertex& end);
+	Edge* searchForEdgeTo(const Vertex& end);
+	const Edge* searchForEdgeTo(const Vertex& end) const;
+	bool hasEdgeTo(const Vertex& end) const;
+	void reserve(size_t count);
+	void empty();
+
+	size_t getCount() const;
+	Iterator getIterator();
+	ConstIterator getConstIterator() const;
+
+private:
+	static const size_t INDEXING_THRESHOLD = 16;
+
+private:
+	void addFront(const Edge& e);
+	void removeFirst();
+	void remove(Edge& edge);
+	void addToIndex(Edge& e);
+	void removeFromIndex(const Vertex& end);
+	void buildIndex(size_t expectedCount);
+	bool isIndexed() const;
+
+private:
+	Box* first;
+	size_t count;
+	BoxAllocator& allocator;
+	std::unique_ptr<Index> index;
+};
+
+#endif //__EDGE_LIST_HEADER_INCLUDED__
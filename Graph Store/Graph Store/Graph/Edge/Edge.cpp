@@ -1,5 +1,13 @@
 #include "Edge.h"
 #include "../Vertex/Vertex.h"
+#include "../Graph Exception/GraphException.h"
+#include <limits>
+
+Edge::Edge() :
+	vertex(nullptr),
+	weight(0)
+{
+}
 
 Edge::Edge(Vertex* v, unsigned weight)
 {
@@ -16,7 +24,14 @@ void Edge::setVertex(Vertex* v)
 
 void Edge::setWeight(unsigned weight)
 {
-	this->weight = weight;
+	if (weight <= std::numeric_limits<Weight>::max())
+	{
+		this->weight = static_cast<Weight>(weight);
+	}
+	else
+	{
+		throw GraphException(String("The weight of the edge is too big!"));
+	}
 }
 
 const Vertex& Edge::getVertex() const
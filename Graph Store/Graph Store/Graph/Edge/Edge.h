@@ -1,11 +1,24 @@
 #ifndef __EDGE_HEADER_INCLUDED__
 #define __EDGE_HEADER_INCLUDED__
 
+#include <cstdint>
+
 class Vertex;
 
+///
+/// Edge weights take 32 bits, or 16 bits when SHORT_EDGE_WEIGHTS is defined.
+///
 class Edge
 {
 	friend class GraphBase;
+	friend class StaticGraph;
+
+public:
+#ifdef SHORT_EDGE_WEIGHTS
+	typedef std::uint16_t Weight;
+#else
+	typedef std::uint32_t Weight;
+#endif
 
 public:
 	const Vertex& getVertex() const;
@@ -13,14 +26,15 @@ public:
 	unsigned getWeight() const;
 
 private:
+	Edge();
 	Edge(Vertex* v, unsigned weight = 1);
 
 	void setVertex(Vertex* v);
 	void setWeight(unsigned weight);
 
 private:
-	unsigned weight;
 	Vertex* vertex;
+	Weight weight;
 };
 
 #endif //__EDGE_HEADER_INCLUDED__
\ No newline at end of file
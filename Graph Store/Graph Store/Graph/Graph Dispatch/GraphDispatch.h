@@ -0,0 +1,64 @@
+#ifndef __GRAPH_DISPATCH_HEADER_INCLUDED__
+#define __GRAPH_DISPATCH_HEADER_INCLUDED__
+
+#include "../Directed Graph/DirectedGraph.h"
+#include "../Undirected Graph/UndirectedGraph.h"
+#include "../Static Graph/StaticGraph.h"
+
+///
+/// Gives a graph of a type unknown to dispatchOnConcreteType the interface
+/// of the concrete graph types, on top of the virtual iterators of Graph.
+///
+class AbstractGraphAdapter
+{
+public:
+	explicit AbstractGraphAdapter(const Graph& graph) :
+		graph(graph)
+	{
+	}
+
+	template <class Function>
+	void forEachEdgeLeaving(const Vertex& v, const Function& function) const
+	{
+		forEach(*graph.getConstIteratorOfEdgesLeaving(v), function);
+	}
+
+	template <class Function>
+	void forEachEdgeEntering(const Vertex& v, const Function& function) const
+	{
+		forEach(*graph.getConstIteratorOfEdgesEntering(v), function);
+	}
+
+private:
+	const Graph& graph;
+};
+
+///
+/// Calls function with the graph cast to its concrete type. The function
+/// is instantiated for each of the types, so a search pays for a virtual
+/// dispatch once per query and its inner loop visits the neighbours of a
+/// vertex through the non-virtual forEachEdgeLeaving of the graph, which
+/// can be inlined.
+///
+template <class Function>
+void dispatchOnConcreteType(const Graph& graph, const Function& function)
+{
+	if (const StaticGraph* staticGraph = dynamic_cast<const StaticGraph*>(&graph))
+	{
+		function(*staticGraph);
+	}
+	else if (const DirectedGraph* directedGraph = dynamic_cast<const DirectedGraph*>(&graph))
+	{
+		function(*directedGraph);
+	}
+	else if (const UndirectedGraph* undirectedGraph = dynamic_cast<const UndirectedGraph*>(&graph))
+	{
+		function(*undirectedGraph);
+	}
+	else
+	{
+		function(AbstractGraphAdapter(graph));
+	}
+}
+
+#endif //__GRAPH_DISPATCH_HEADER_INCLUDED__
\ No newline at end of file
@@ -1,11 +1,13 @@
 #include "GraphBase.h"
 #include "../Graph Exception/GraphException.h"
 #include "../../Iterator/ConcreteIteratorAdapter.h"
+#include <algorithm>
 
-GraphBase::GraphBase(const String& id) :
+GraphBase::GraphBase(const String& id, bool keepsIncomingEdges) :
 	Graph(id),
 	vertices(INITIAL_COLLECTION_SIZE),
-	vertexSearchSet(INITIAL_COLLECTION_SIZE)
+	vertexSearchSet(INITIAL_COLLECTION_SIZE),
+	keepsIncomingEdges(keepsIncomingEdges)
 {
 }
 
@@ -14,62 +16,62 @@ GraphBase::~GraphBase()
 	destroyAllVertices();
 }
 
+///
+/// The memory of the vertices and their edges belongs to the allocators
+/// of the graph and is freed slab by slab when they are destroyed, so the
+/// vertices are only destructed here.
+///
 void GraphBase::destroyAllVertices()
 {
 	VerticesConcreteIterator iterator = getConcreteIteratorOfVertices();
 
 	forEach(iterator, [&](Vertex* v)
 	{
-		delete v;
+		v->~Vertex();
 	});
 }
 
+void GraphBase::destroyVertex(Vertex& v)
+{
+	v.~Vertex();
+	vertexAllocator.release(&v);
+}
+
+///
+/// Removing a vertex renumbers the last one, so the watched trees are
+/// built again rather than repaired edge by edge.
+///
 void GraphBase::removeVertex(Vertex& v)
 {
 	verifyOwnershipOf(v);
+	markAsModified();
+	stopWatching(v);
 
 	removeEdgesEndingIn(v);
 	removeEdgesLeaving(v);
 	removeVertexFromCollection(v);
-	
-	delete &v;
+	destroyVertex(v);
+
+	rebuildWatchedTrees();
 }
 
-void GraphBase::removeEdgeFromTo(Vertex& start, const Vertex& end)
+void GraphBase::removeEdgeFromTo(Vertex& start, Vertex& end)
 {
 	assert(isOwnerOf(start));
 	assert(isOwnerOf(end));
 
-	EdgesConcreteIterator iteratorToEdge = searchForEdgeFromTo(start, end);
-
-	if (iteratorToEdge)
-	{
-		getEdgesLeaving(start).removeAt(iteratorToEdge);
-	}
-	else
+	if (!getEdgesLeaving(start).removeEdgeTo(end))
 	{
 		throw GraphException(String("There is no such edge!"));
 	}
-}
 
-GraphBase::EdgesConcreteIterator GraphBase::searchForEdgeFromTo(Vertex& start, const Vertex& end)
-{
-	assert(isOwnerOf(start));
-	assert(isOwnerOf(end));
-
-	EdgesConcreteIterator iterator = getConcreteIteratorOfEdgesLeaving(start);
+	markAsModified();
 
-	while (iterator)
+	if (keepsIncomingEdges)
 	{
-		if (iterator->getVertex() == end)
-		{
-			break;
-		}
-
-		++iterator;
+		bool removedIncomingEdge = end.incomingEdges.removeEdgeTo(start);
+		assert(removedIncomingEdge);
 	}
-
-	return iterator;
 }
 
 bool GraphBase::hasEdgeFromTo(const Vertex& start, const Vertex& end) const
@@ -77,27 +79,44 @@ bool GraphBase::hasEdgeFromTo(const Vertex& start, const Vertex& end) const
 	assert(isOwnerOf(start));
 	assert(isOwnerOf(end));
 
-	const LinkedList<Edge>& edges = start.edges;
-	LinkedList<Edge>::ConstIterator iterator = edges.getConstIterator();
+	return start.edges.hasEdgeTo(end);
+}
+
+void GraphBase::removeEdgesLeaving(Vertex& v)
+{
+	assert(isOwnerOf(v));
 
-	while(iterator)
+	if (keepsIncomingEdges)
 	{
-		if (iterator->getVertex() == end)
-		{
-			return true;
-		}
+		EdgesConcreteIterator iterator = getConcreteIteratorOfEdgesLeaving(v);
 
-		++iterator;
+		forEach(iterator, [&](Edge& e)
+		{
+			e.getVertex().incomingEdges.removeEdgeTo(v);
+		});
 	}
 
-	return false;
+	getEdgesLeaving(v).empty();
 }
 
-void GraphBase::removeEdgesLeaving(Vertex& v)
+///
+/// Uses the incoming edges of the vertex to reach the lists the edges
+/// ending in it are in, so only its in-degree many lists are visited.
+///
+void GraphBase::removeEdgesEntering(Vertex& v)
 {
 	assert(isOwnerOf(v));
+	assert(keepsIncomingEdges);
 
-	getEdgesLeaving(v).empty();
+	EdgesConcreteIterator iterator = v.incomingEdges.getIterator();
+
+	forEach(iterator, [&](Edge& e)
+	{
+		bool removedEdge = getEdgesLeaving(e.getVertex()).removeEdgeTo(v);
+		assert(removedEdge);
+	});
+
+	v.incomingEdges.empty();
 }
 
 void GraphBase::removeVertexFromCollection(const Vertex& vertex)
@@ -118,6 +137,7 @@ void GraphBase::addVertex(const String& id)
 {
 	if (!hasVertexWithID(id))
 	{
+		markAsModified();
 		tryToAddNewVertex(id);
 	}
 	else
@@ -135,8 +155,17 @@ void GraphBase::tryToAddNewVertex(const String& id)
 {
 	try
 	{
-		std::unique_ptr<Vertex> newVertex = createVertex(id);
-		addVertexToCollection(std::move(newVertex));
+		Vertex& newVertex = createVertex(id);
+
+		try
+		{
+			addVertexToCollection(newVertex);
+		}
+		catch (std::bad_alloc&)
+		{
+			destroyVertex(newVertex);
+			throw;
+		}
 	}
 	catch (std::bad_alloc&)
 	{
@@ -144,29 +173,36 @@ void GraphBase::tryToAddNewVertex(const String& id)
 	}
 }
 
-std::unique_ptr<Vertex> GraphBase::createVertex(const String& id) const
+Vertex& GraphBase::createVertex(const String& id)
 {
-	return std::unique_ptr<Vertex>(new Vertex(id, vertices.getCount()));
+	Vertex* memory = vertexAllocator.allocate();
+
+	try
+	{
+		return *new (memory) Vertex(id, vertices.getCount(), edgeAllocator);
+	}
+	catch (...)
+	{
+		vertexAllocator.release(memory);
+		throw;
+	}
 }
 
-void GraphBase::addVertexToCollection(std::unique_ptr<Vertex> vertex)
+void GraphBase::addVertexToCollection(Vertex& vertex)
 {
-	assert(vertex != nullptr);
-	assert(vertex->index == vertices.getCount());
+	assert(vertex.index == vertices.getCount());
 
-	vertices.add(vertex.get());
+	vertices.add(&vertex);
 
 	try
 	{
-		vertexSearchSet.add(*vertex);
+		vertexSearchSet.add(vertex);
 	}
 	catch (std::bad_alloc&)
 	{
-		vertices.removeAt(vertex->index);
+		vertices.removeAt(vertex.index);
 		throw;
 	}
-
-	vertex.release();
 }
 
 Vertex& GraphBase::getVertexWithID(const String& id)
@@ -186,14 +222,224 @@ void GraphBase::addEdgeFromTo(Vertex& start, Vertex& end, unsigned weight)
 	assert(isOwnerOf(start));
 	assert(isOwnerOf(end));
 
+	markAsModified();
+
 	try
 	{
-		getEdgesLeaving(start).addFront(Edge(&end, weight));
+		getEdgesLeaving(start).add(Edge(&end, weight));
 	}
 	catch (std::bad_alloc&)
 	{
 		throw GraphException(String("Not enough memory!"));
 	}
+
+	if (keepsIncomingEdges)
+	{
+		addIncomingEdge(start, end, weight);
+	}
+}
+
+void GraphBase::addIncomingEdge(Vertex& start, Vertex& end, unsigned weight)
+{
+	try
+	{
+		end.incomingEdges.add(Edge(&start, weight));
+	}
+	catch (std::bad_alloc&)
+	{
+		getEdgesLeaving(start).removeEdgeTo(end);
+		throw GraphException(String("Not enough memory!"));
+	}
+}
+
+///
+/// Adds the vertices with the identifiers and the edges between them to an
+/// empty graph, with the edges referring to the vertices by their positions
+/// in identifiers. An edge given more than once is added once, with the
+/// weight it is first given; in an undirected graph an edge and its reverse
+/// are the same edge.
+///
+/// Unlike addEdge, this takes time linear in the number of edges: the
+/// edges are bucketed by their start with a counting sort, which brings the
+/// repeated ones together, and the boxes and indices of the edge lists are
+/// allocated up front from the degrees of the vertices.
+///
+/// If an exception is thrown, the graph is left partly loaded and should be
+/// discarded.
+///
+void GraphBase::bulkLoad(const DynamicArray<String>& identifiers, const IndexedEdgesArray& edges)
+{
+	if (getVerticesCount() != 0)
+	{
+		throw GraphException(String("Only an empty graph can be loaded in bulk!"));
+	}
+
+	markAsModified();
+
+	try
+	{
+		addVerticesInBulk(identifiers);
+		addEdgesInBulk(groupDistinctEdgesByStart(edges));
+	}
+	catch (std::bad_alloc&)
+	{
+		throw GraphException(String("Not enough memory!"));
+	}
+}
+
+void GraphBase::addVerticesInBulk(const DynamicArray<String>& identifiers)
+{
+	size_t count = identifiers.getCount();
+
+	vertexAllocator.reserve(count);
+	vertices.ensureSize(count);
+	vertexSearchSet = Hash(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (hasVertexWithID(identifiers[i]))
+		{
+			throw GraphException("There already is a vertex with id: " + identifiers[i]);
+		}
+
+		Vertex& newVertex = createVertex(identifiers[i]);
+
+		try
+		{
+			addVertexToCollection(newVertex);
+		}
+		catch (std::bad_alloc&)
+		{
+			destroyVertex(newVertex);
+			throw;
+		}
+	}
+}
+
+///
+/// The edges of an undirected graph are turned to start at their end with
+/// the smaller index first. Within a bucket the edges keep their order, so
+/// the first of the repeated ones is kept: an edge is dropped when the last
+/// edge found to its end started at the same vertex.
+///
+Graph::IndexedEdgesArray GraphBase::groupDistinctEdgesByStart(const IndexedEdgesArray& edges) const
+{
+	const unsigned NONE = static_cast<unsigned>(-1);
+	size_t verticesCount = getVerticesCount();
+	bool isUndirected = !isDirected();
+	std::vector<size_t> bucketEnds(verticesCount, 0);
+
+	for (const IndexedEdge& e : edges)
+	{
+		verifyIndicesOf(e);
+		unsigned start = isUndirected ? std::min(e.startIndex, e.endIndex) : e.startIndex;
+
+		++bucketEnds[start];
+	}
+
+	size_t bucketStart = 0;
+
+	for (size_t& bucketEnd : bucketEnds)
+	{
+		size_t bucketSize = bucketEnd;
+		bucketEnd = bucketStart;
+		bucketStart += bucketSize;
+	}
+
+	IndexedEdgesArray grouped(edges.size());
+
+	for (const IndexedEdge& e : edges)
+	{
+		IndexedEdge edge = e;
+
+		if (isUndirected && edge.startIndex > edge.endIndex)
+		{
+			std::swap(edge.startIndex, edge.endIndex);
+		}
+
+		grouped[bucketEnds[edge.startIndex]++] = edge;
+	}
+
+	std::vector<unsigned> lastStartTo(verticesCount, NONE);
+	size_t distinctCount = 0;
+
+	for (const IndexedEdge& e : grouped)
+	{
+		if (lastStartTo[e.endIndex] != e.startIndex)
+		{
+			lastStartTo[e.endIndex] = e.startIndex;
+			grouped[distinctCount++] = e;
+		}
+	}
+
+	grouped.resize(distinctCount);
+
+	return grouped;
+}
+
+void GraphBase::verifyIndicesOf(const IndexedEdge& e) const
+{
+	if (e.startIndex >= getVerticesCount() || e.endIndex >= getVerticesCount())
+	{
+		throw GraphException(String("An edge refers to a vertex which does not exist!"));
+	}
+}
+
+///
+/// An undirected edge is kept as an edge leaving each of its ends, as
+/// addEdge of UndirectedGraph keeps it.
+///
+void GraphBase::addEdgesInBulk(const IndexedEdgesArray& edges)
+{
+	bool isUndirected = !isDirected();
+	std::vector<size_t> degrees(getVerticesCount(), 0);
+	std::vector<size_t> inDegrees(keepsIncomingEdges ? getVerticesCount() : 0, 0);
+
+	for (const IndexedEdge& e : edges)
+	{
+		++degrees[e.startIndex];
+
+		if (isUndirected)
+		{
+			++degrees[e.endIndex];
+		}
+
+		if (keepsIncomingEdges)
+		{
+			++inDegrees[e.endIndex];
+		}
+	}
+
+	size_t boxesCount = (isUndirected ? 2 : 1) * edges.size() + (keepsIncomingEdges ? edges.size() : 0);
+	edgeAllocator.reserve(boxesCount);
+
+	for (size_t i = 0; i < getVerticesCount(); ++i)
+	{
+		vertices[i]->edges.reserve(degrees[i]);
+
+		if (keepsIncomingEdges)
+		{
+			vertices[i]->incomingEdges.reserve(inDegrees[i]);
+		}
+	}
+
+	for (const IndexedEdge& e : edges)
+	{
+		Vertex& start = *vertices[e.startIndex];
+		Vertex& end = *vertices[e.endIndex];
+
+		start.edges.add(Edge(&end, e.weight));
+
+		if (isUndirected)
+		{
+			end.edges.add(Edge(&start, e.weight));
+		}
+
+		if (keepsIncomingEdges)
+		{
+			end.incomingEdges.add(Edge(&start, e.weight));
+		}
+	}
 }
 
 Graph::VerticesConstIterator GraphBase::getConstIteratorOfVertices() const
@@ -208,21 +454,48 @@ GraphBase::VerticesConcreteIterator GraphBase::getConcreteIteratorOfVertices()
 	return vertices.getIterator();
 }
 
+Vertex& GraphBase::getVertexAt(size_t index)
+{
+	return *vertices[index];
+}
+
 Graph::EdgesConstIterator GraphBase::getConstIteratorOfEdgesLeaving(const Vertex& v) const
 {
-	typedef ConcreteIteratorAdapter<Edge, LinkedList<Edge>::ConstIterator, true> ConcreteConstIterator;
+	typedef ConcreteIteratorAdapter<Edge, EdgeList::ConstIterator, true> ConcreteConstIterator;
 
 	verifyOwnershipOf(v);
-	const LinkedList<Edge>& edges = v.edges;
+	const EdgeList& edges = v.edges;
 
 	return EdgesConstIterator(new ConcreteConstIterator(edges.getConstIterator()));
 }
 
+Graph::EdgesConstIterator GraphBase::getConstIteratorOfEdgesEntering(const Vertex& v) const
+{
+	typedef ConcreteIteratorAdapter<Edge, EdgeList::ConstIterator, true> ConcreteConstIterator;
+
+	verifyOwnershipOf(v);
+
+	if (keepsIncomingEdges)
+	{
+		const EdgeList& edges = v.incomingEdges;
+
+		return EdgesConstIterator(new ConcreteConstIterator(edges.getConstIterator()));
+	}
+	else if (!isDirected())
+	{
+		return getConstIteratorOfEdgesLeaving(v);
+	}
+	else
+	{
+		throw GraphException(String("The graph does not keep track of incoming edges!"));
+	}
+}
+
 GraphBase::EdgesConcreteIterator GraphBase::getConcreteIteratorOfEdgesLeaving(Vertex& v)
 {
 	assert(isOwnerOf(v));
 
-	return getEdgesLeaving(v).getIteratorToFirst();
+	return getEdgesLeaving(v).getIterator();
 }
 
 void GraphBase::verifyOwnershipOf(const Vertex& v) const
@@ -238,7 +511,7 @@ bool GraphBase::isOwnerOf(const Vertex& v) const
 	return v.index < vertices.getCount() && vertices[v.index] == &v;
 }
 
-LinkedList<Edge>& GraphBase::getEdgesLeaving(Vertex& v)
+EdgeList& GraphBase::getEdgesLeaving(Vertex& v)
 {
 	assert(isOwnerOf(v));
 
@@ -5,16 +5,20 @@
 #include "../../Hash/Hash.h"
 #include "../../Hash/Hash Function/HashFunctionStringSpecialization.h"
 #include "../../Hash/Identifier Accessor/IdentifierAccessor.h"
+#include "../../Slab Allocator/SlabAllocator.h"
 #include "../Abstract class/Graph.h"
+#include <assert.h>
+#include <vector>
 
 class GraphBase : public Graph
 {
 	typedef Hash<Vertex, String, IdentifierAccessor> Hash;
 	typedef DynamicArray<Vertex*> Array;
+	typedef SlabAllocator<Vertex> VertexAllocator;
 
 protected:
 	typedef DynamicArray<Vertex*>::Iterator VerticesConcreteIterator;
-	typedef LinkedList<Edge>::Iterator EdgesConcreteIterator;
+	typedef EdgeList::Iterator EdgesConcreteIterator;
 
 public:
 	GraphBase(const GraphBase&) = delete;
@@ -23,41 +27,86 @@ public:
 
 	virtual void addVertex(const String& id) override;
 	virtual void removeVertex(Vertex& v) override;
+	virtual void bulkLoad(const DynamicArray<String>& identifiers, const IndexedEdgesArray& edges) override;
 
 	virtual Vertex& getVertexWithID(const String& id) override;
 	virtual VerticesConstIterator getConstIteratorOfVertices() const override;
 	virtual EdgesConstIterator getConstIteratorOfEdgesLeaving(const Vertex& v) const override;
+	virtual EdgesConstIterator getConstIteratorOfEdgesEntering(const Vertex& v) const override;
 	virtual unsigned getVerticesCount() const override;
 
 protected:
-	GraphBase(const String& id);
+	GraphBase(const String& id, bool keepsIncomingEdges = false);
 
 	virtual void removeEdgesEndingIn(Vertex& v) = 0;
 	virtual void removeEdgesLeaving(Vertex& v);
-	void removeEdgeFromTo(Vertex& start, const Vertex& end);
+	void removeEdgesEntering(Vertex& v);
+	void removeEdgeFromTo(Vertex& start, Vertex& end);
 	void addEdgeFromTo(Vertex& start, Vertex& end, unsigned weight);
 	bool hasEdgeFromTo(const Vertex& start, const Vertex& end) const;
 	bool hasVertexWithID(const String& id) const;
 	void verifyOwnershipOf(const Vertex& v) const;
 	bool isOwnerOf(const Vertex& v) const;	
 	VerticesConcreteIterator getConcreteIteratorOfVertices();
+	Vertex& getVertexAt(size_t index);
 	EdgesConcreteIterator getConcreteIteratorOfEdgesLeaving(Vertex& v);
 
+	template <class Function>
+	void forEachEdgeLeaving(const Vertex& v, const Function& function) const;
+
+	template <class Function>
+	void forEachEdgeEntering(const Vertex& v, const Function& function) const;
+
 private:
 	void tryToAddNewVertex(const String& id);
-	void addVertexToCollection(std::unique_ptr<Vertex> vertex);
+	void addVertexToCollection(Vertex& vertex);
 	void removeVertexFromCollection(const Vertex& vertex);
-	EdgesConcreteIterator searchForEdgeFromTo(Vertex& start, const Vertex& end);
-	LinkedList<Edge>& getEdgesLeaving(Vertex& v);
-	std::unique_ptr<Vertex> createVertex(const String& id) const;
+	void addIncomingEdge(Vertex& start, Vertex& end, unsigned weight);
+	EdgeList& getEdgesLeaving(Vertex& v);
+	Vertex& createVertex(const String& id);
+	void destroyVertex(Vertex& v);
 	void destroyAllVertices();
+	void addVerticesInBulk(const DynamicArray<String>& identifiers);
+	void addEdgesInBulk(const IndexedEdgesArray& edges);
+	IndexedEdgesArray groupDistinctEdgesByStart(const IndexedEdgesArray& edges) const;
+	void verifyIndicesOf(const IndexedEdge& e) const;
 
 private:
 	static const size_t INITIAL_COLLECTION_SIZE = 16;
 
 private:
+	VertexAllocator vertexAllocator;
+	EdgeList::BoxAllocator edgeAllocator;
 	Array vertices;
 	Hash vertexSearchSet;
+	bool keepsIncomingEdges;
 };
 
+///
+/// Walks the edge list of v directly, so a caller which knows the concrete
+/// type of the graph visits the neighbours of v without the virtual calls
+/// and the allocation of getConstIteratorOfEdgesLeaving. The graphs which
+/// keep their edges in these lists make it public.
+///
+template <class Function>
+inline void GraphBase::forEachEdgeLeaving(const Vertex& v, const Function& function) const
+{
+	assert(isOwnerOf(v));
+
+	EdgeList::ConstIterator iterator = v.edges.getConstIterator();
+
+	forEach(iterator, function);
+}
+
+template <class Function>
+inline void GraphBase::forEachEdgeEntering(const Vertex& v, const Function& function) const
+{
+	assert(isOwnerOf(v));
+	assert(keepsIncomingEdges);
+
+	EdgeList::ConstIterator iterator = v.incomingEdges.getConstIterator();
+
+	forEach(iterator, function);
+}
+
 #endif //__GRAPH_BASE_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,313 @@
+#include "StaticGraph.h"
+#include "../Graph Exception/GraphException.h"
+#include "../Directed Static Graph/DirectedStaticGraph.h"
+#include "../Undirected Static Graph/UndirectedStaticGraph.h"
+#include "../../Iterator/ConcreteIteratorAdapter.h"
+#include "../../Shortest Path Algorithms/Contraction Hierarchy/ContractionHierarchy.h"
+
+///
+/// Creates a static graph of the kind of graph, with the same id, vertices
+/// and edges.
+///
+std::unique_ptr<StaticGraph> StaticGraph::createFrozenCopyOf(const Graph& graph)
+{
+	std::unique_ptr<StaticGraph> frozenGraph;
+
+	try
+	{
+		if (graph.isDirected())
+		{
+			frozenGraph.reset(new DirectedStaticGraph(graph.getID()));
+		}
+		else
+		{
+			frozenGraph.reset(new UndirectedStaticGraph(graph.getID()));
+		}
+	}
+	catch (std::bad_alloc&)
+	{
+		throw GraphException(String("Not enough memory to freeze the graph!"));
+	}
+
+	frozenGraph->buildFrom(graph);
+
+	return frozenGraph;
+}
+
+StaticGraph::StaticGraph(const String& id) :
+	GraphBase(id)
+{
+}
+
+StaticGraph::~StaticGraph()
+{
+}
+
+void StaticGraph::buildFrom(const Graph& graph)
+{
+	assert(getVerticesCount() == 0);
+	assert(edges.empty());
+
+	try
+	{
+		tryToBuildFrom(graph);
+	}
+	catch (std::bad_alloc&)
+	{
+		throw GraphException(String("Not enough memory to freeze the graph!"));
+	}
+}
+
+void StaticGraph::tryToBuildFrom(const Graph& graph)
+{
+	copyVerticesOf(graph);
+	copyEdgesOf(graph);
+
+	if (isDirected())
+	{
+		buildIncomingEdges();
+	}
+}
+
+///
+/// The vertices are added in the order of their indices in the source
+/// graph, so a vertex keeps its index in the frozen copy.
+///
+void StaticGraph::copyVerticesOf(const Graph& graph)
+{
+	verticesByIndex.reserve(graph.getVerticesCount());
+
+	forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+	{
+		GraphBase::addVertex(v->getID());
+		verticesByIndex.push_back(&getVertexAt(v->getIndex()));
+
+		assert(verticesByIndex.back()->getID() == v->getID());
+	});
+}
+
+void StaticGraph::copyEdgesOf(const Graph& graph)
+{
+	offsets.reserve(graph.getVerticesCount() + 1);
+	edges.reserve(countEdgesOf(graph));
+
+	forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+	{
+		offsets.push_back(edges.size());
+		copyEdgesLeaving(*v, graph);
+	});
+
+	offsets.push_back(edges.size());
+}
+
+size_t StaticGraph::countEdgesOf(const Graph& graph)
+{
+	size_t edgesCount = 0;
+
+	forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+	{
+		forEach(*graph.getConstIteratorOfEdgesLeaving(*v), [&](const Edge&)
+		{
+			++edgesCount;
+		});
+	});
+
+	return edgesCount;
+}
+
+void StaticGraph::copyEdgesLeaving(const Vertex& v, const Graph& graph)
+{
+	forEach(*graph.getConstIteratorOfEdgesLeaving(v), [&](const Edge& e)
+	{
+		edges.push_back(compress(e));
+	});
+}
+
+StaticGraph::CompactEdge StaticGraph::compress(const Edge& e)
+{
+	CompactEdge compactEdge;
+	compactEdge.vertexIndex = static_cast<std::uint32_t>(e.getVertex().getIndex());
+	compactEdge.weight = e.weight;
+
+	return compactEdge;
+}
+
+void StaticGraph::buildIncomingEdges()
+{
+	countIncomingEdges();
+
+	OffsetsArray nextFreePosition(incomingOffsets.cbegin(), incomingOffsets.cend() - 1);
+	incomingEdges.resize(edges.size());
+
+	for (size_t startIndex = 0; startIndex < verticesByIndex.size(); ++startIndex)
+	{
+		for (size_t i = offsets[startIndex]; i < offsets[startIndex + 1]; ++i)
+		{
+			CompactEdge& incomingEdge = incomingEdges[nextFreePosition[edges[i].vertexIndex]++];
+
+			incomingEdge.vertexIndex = static_cast<std::uint32_t>(startIndex);
+			incomingEdge.weight = edges[i].weight;
+		}
+	}
+}
+
+void StaticGraph::countIncomingEdges()
+{
+	incomingOffsets.assign(verticesByIndex.size() + 1, 0);
+
+	for (const CompactEdge& e : edges)
+	{
+		++incomingOffsets[e.vertexIndex + 1];
+	}
+
+	for (size_t i = 1; i < incomingOffsets.size(); ++i)
+	{
+		incomingOffsets[i] += incomingOffsets[i - 1];
+	}
+}
+
+Graph::EdgesConstIterator StaticGraph::getConstIteratorOfEdgesLeaving(const Vertex& v) const
+{
+	verifyOwnershipOf(v);
+
+	return createIteratorOfEdgesOf(v, edges, offsets);
+}
+
+Graph::EdgesConstIterator StaticGraph::getConstIteratorOfEdgesEntering(const Vertex& v) const
+{
+	if (!isDirected())
+	{
+		return getConstIteratorOfEdgesLeaving(v);
+	}
+
+	verifyOwnershipOf(v);
+
+	return createIteratorOfEdgesOf(v, incomingEdges, incomingOffsets);
+}
+
+Graph::EdgesConstIterator StaticGraph::createIteratorOfEdgesOf(const Vertex& v,
+															   const EdgesArray& edges,
+															   const OffsetsArray& offsets) const
+{
+	typedef ConcreteIteratorAdapter<Edge, CompactEdgeIterator, true> ConcreteConstIterator;
+
+	const CompactEdge* edgesOfGraph = edges.data();
+	size_t index = v.getIndex();
+
+	CompactEdgeIterator iterator(edgesOfGraph + offsets[index],
+								 edgesOfGraph + offsets[index + 1],
+								 verticesByIndex.data());
+
+	return EdgesConstIterator(new ConcreteConstIterator(iterator));
+}
+
+const ContractionHierarchy* StaticGraph::getContractionHierarchy() const
+{
+	return contractionHierarchy.get();
+}
+
+///
+/// A frozen graph never changes, so its hierarchy stays valid for as long
+/// as the graph lives.
+///
+void StaticGraph::setContractionHierarchy(std::unique_ptr<ContractionHierarchy> hierarchy)
+{
+	contractionHierarchy = std::move(hierarchy);
+}
+
+void StaticGraph::addVertex(const String&)
+{
+	throwFrozenGraphException();
+}
+
+void StaticGraph::removeVertex(Vertex&)
+{
+	throwFrozenGraphException();
+}
+
+void StaticGraph::addEdge(Vertex&, Vertex&, unsigned)
+{
+	throwFrozenGraphException();
+}
+
+void StaticGraph::removeEdge(Vertex&, Vertex&)
+{
+	throwFrozenGraphException();
+}
+
+void StaticGraph::bulkLoad(const DynamicArray<String>&, const IndexedEdgesArray&)
+{
+	throwFrozenGraphException();
+}
+
+void StaticGraph::removeEdgesEndingIn(Vertex&)
+{
+	throwFrozenGraphException();
+}
+
+void StaticGraph::throwFrozenGraphException()
+{
+	throw GraphException(String("The graph is frozen and can not be modified!"));
+}
+
+StaticGraph::CompactEdgeIterator::CompactEdgeIterator(const CompactEdge* first,
+													  const CompactEdge* end,
+													  Vertex* const* vertices) :
+	current(first),
+	end(end),
+	vertices(vertices)
+{
+}
+
+StaticGraph::CompactEdgeIterator& StaticGraph::CompactEdgeIterator::operator++()
+{
+	if (isValid())
+	{
+		++current;
+	}
+
+	return *this;
+}
+
+StaticGraph::CompactEdgeIterator::Reference
+StaticGraph::CompactEdgeIterator::operator*() const
+{
+	return getCurrentItem();
+}
+
+StaticGraph::CompactEdgeIterator::Pointer
+StaticGraph::CompactEdgeIterator::operator->() const
+{
+	return &getCurrentItem();
+}
+
+bool StaticGraph::CompactEdgeIterator::operator!() const
+{
+	return !isValid();
+}
+
+StaticGraph::CompactEdgeIterator::operator bool() const
+{
+	return isValid();
+}
+
+StaticGraph::CompactEdgeIterator::Reference
+StaticGraph::CompactEdgeIterator::getCurrentItem() const
+{
+	if (isValid())
+	{
+		currentEdge.vertex = vertices[current->vertexIndex];
+		currentEdge.weight = current->weight;
+
+		return currentEdge;
+	}
+	else
+	{
+		throw std::out_of_range("Iterator out of range!");
+	}
+}
+
+bool StaticGraph::CompactEdgeIterator::isValid() const
+{
+	return current != end;
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#ifndef __STATIC_GRAPH_HEADER_INCLUDED__
+#define __STATIC_GRAPH_HEADER_INCLUDED__
+
+#include "../GraphBase/GraphBase.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class ContractionHierarchy;
+
+///
+/// An immutable graph which keeps its edges in compressed sparse row form:
+/// the edges leaving the vertex with index i are stored contiguously in
+/// edges[offsets[i]] ... edges[offsets[i + 1] - 1], so scanning the
+/// neighbours of a vertex is a sequential walk over a single array.
+/// Directed graphs keep the reversed edges in the same form as well.
+///
+/// The vertices of a frozen graph never change their indices, so an edge
+/// is stored as the index of the vertex at its other end and its weight,
+/// which takes 8 bytes (6 with SHORT_EDGE_WEIGHTS) instead of the 16 of
+/// an Edge. The iterators expand them to Edge objects on the fly.
+///
+/// A static graph is only ever built from another graph (see FREEZE), so
+/// its types are not registered with the GraphFactory: an empty one could
+/// never be filled.
+///
+class StaticGraph : public GraphBase
+{
+#ifdef SHORT_EDGE_WEIGHTS
+#pragma pack(push, 2)
+#endif
+	struct CompactEdge
+	{
+		std::uint32_t vertexIndex;
+		Edge::Weight weight;
+	};
+#ifdef SHORT_EDGE_WEIGHTS
+#pragma pack(pop)
+#endif
+
+	typedef std::vector<CompactEdge> EdgesArray;
+	typedef std::vector<size_t> OffsetsArray;
+	typedef std::vector<Vertex*> VerticesArray;
+
+	class CompactEdgeIterator
+	{
+	public:
+		typedef const Edge& Reference;
+		typedef const Edge* Pointer;
+
+	public:
+		CompactEdgeIterator(const CompactEdge* first,
+							const CompactEdge* end,
+							Vertex* const* vertices);
+
+		CompactEdgeIterator& operator++();
+		Reference operator*() const;
+		Pointer operator->() const;
+		bool operator!() const;
+		operator bool() const;
+
+	private:
+		Reference getCurrentItem() const;
+		bool isValid() const;
+
+	private:
+		const CompactEdge* current;
+		const CompactEdge* end;
+		Vertex* const* vertices;
+		mutable Edge currentEdge;
+	};
+
+public:
+	static std::unique_ptr<StaticGraph> createFrozenCopyOf(const Graph& graph);
+
+public:
+	virtual ~StaticGraph();
+
+	virtual void addVertex(const String& id) override;
+	virtual void removeVertex(Vertex& v) override;
+	virtual void addEdge(Vertex& start, Vertex& end, unsigned weight) override;
+	virtual void removeEdge(Vertex& start, Vertex& end) override;
+	virtual void bulkLoad(const DynamicArray<String>& identifiers, const IndexedEdgesArray& edges) override;
+	virtual EdgesConstIterator getConstIteratorOfEdgesLeaving(const Vertex& v) const override;
+	virtual EdgesConstIterator getConstIteratorOfEdgesEntering(const Vertex& v) const override;
+
+	void buildFrom(const Graph& graph);
+	const ContractionHierarchy* getContractionHierarchy() const;
+	void setContractionHierarchy(std::unique_ptr<ContractionHierarchy> hierarchy);
+
+	template <class Function>
+	void forEachEdgeLeaving(const Vertex& v, const Function& function) const;
+
+	template <class Function>
+	void forEachEdgeEntering(const Vertex& v, const Function& function) const;
+
+protected:
+	StaticGraph(const String& id);
+
+	virtual void removeEdgesEndingIn(Vertex& v) override;
+
+private:
+	static void throwFrozenGraphException();
+	static size_t countEdgesOf(const Graph& graph);
+	static CompactEdge compress(const Edge& e);
+
+private:
+	void tryToBuildFrom(const Graph& graph);
+	void copyVerticesOf(const Graph& graph);
+	void copyEdgesOf(const Graph& graph);
+	void copyEdgesLeaving(const Vertex& v, const Graph& graph);
+	void buildIncomingEdges();
+	void countIncomingEdges();
+	EdgesConstIterator createIteratorOfEdgesOf(const Vertex& v,
+											   const EdgesArray& edges,
+											   const OffsetsArray& offsets) const;
+
+	template <class Function>
+	void forEachEdgeOf(const Vertex& v,
+					   const EdgesArray& edges,
+					   const OffsetsArray& offsets,
+					   const Function& function) const;
+
+private:
+	VerticesArray verticesByIndex;
+	OffsetsArray offsets;
+	EdgesArray edges;
+	OffsetsArray incomingOffsets;
+	EdgesArray incomingEdges;
+	std::unique_ptr<ContractionHierarchy> contractionHierarchy;
+};
+
+template <class Function>
+inline void StaticGraph::forEachEdgeLeaving(const Vertex& v, const Function& function) const
+{
+	forEachEdgeOf(v, edges, offsets, function);
+}
+
+///
+/// Only directed graphs build the reversed edges.
+///
+template <class Function>
+inline void StaticGraph::forEachEdgeEntering(const Vertex& v, const Function& function) const
+{
+	if (!incomingOffsets.empty())
+	{
+		forEachEdgeOf(v, incomingEdges, incomingOffsets, function);
+	}
+	else
+	{
+		forEachEdgeOf(v, edges, offsets, function);
+	}
+}
+
+///
+/// Expands the compact edges of v one at a time into a single Edge on the
+/// stack, so scanning the neighbours of v neither allocates nor goes
+/// through a virtual call per edge.
+///
+template <class Function>
+void StaticGraph::forEachEdgeOf(const Vertex& v,
+								const EdgesArray& edges,
+								const OffsetsArray& offsets,
+								const Function& function) const
+{
+	assert(isOwnerOf(v));
+
+	const CompactEdge* current = edges.data() + offsets[v.getIndex()];
+	const CompactEdge* end = edges.data() + offsets[v.getIndex() + 1];
+	Edge edge;
+
+	for (; current != end; ++current)
+	{
+		edge.vertex = verticesByIndex[current->vertexIndex];
+		edge.weight = current->weight;
+
+		function(static_cast<const Edge&>(edge));
+	}
+}
+
+#endif //__STATIC_GRAPH_HEADER_INCLUDED__
\ No newline at end of file
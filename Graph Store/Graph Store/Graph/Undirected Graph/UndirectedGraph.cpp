@@ -17,6 +17,8 @@ void UndirectedGraph::addEdge(Vertex& start, Vertex& end, unsigned weight)
 	if (!hasEdgeFromTo(start, end))
 	{
 		tryToAddUndirectedEdge(start, end, weight);
+		repairWatchedTreesAfterAdding(start, end, weight);
+		repairWatchedTreesAfterAdding(end, start, weight);
 	}
 	else
 	{
@@ -46,6 +48,13 @@ void UndirectedGraph::removeEdge(Vertex& start, Vertex& end)
 
 	removeEdgeFromTo(start, end);
 	removeEdgeFromTo(end, start);
+	repairWatchedTreesAfterRemoving(start, end);
+	repairWatchedTreesAfterRemoving(end, start);
+}
+
+bool UndirectedGraph::isDirected() const
+{
+	return false;
 }
 
 void UndirectedGraph::removeEdgesEndingIn(Vertex& v)
@@ -10,6 +10,12 @@ public:
 
 	virtual void addEdge(Vertex& start, Vertex& end, unsigned weight) override;
 	virtual void removeEdge(Vertex& start, Vertex& end) override;
+	virtual bool isDirected() const override;
+
+	using GraphBase::forEachEdgeLeaving;
+
+	template <class Function>
+	void forEachEdgeEntering(const Vertex& v, const Function& function) const;
 
 protected:
 	virtual void removeEdgesEndingIn(Vertex& v) override;
@@ -18,4 +24,13 @@ private:
 	void tryToAddUndirectedEdge(Vertex& start, Vertex& end, unsigned weight);
 };
 
+///
+/// Every edge of an undirected graph both enters and leaves its ends.
+///
+template <class Function>
+inline void UndirectedGraph::forEachEdgeEntering(const Vertex& v, const Function& function) const
+{
+	forEachEdgeLeaving(v, function);
+}
+
 #endif //__UNDIRECTED_GRAPH_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,11 @@
+#include "UndirectedStaticGraph.h"
+
+UndirectedStaticGraph::UndirectedStaticGraph(const String& id) :
+	StaticGraph(id)
+{
+}
+
+bool UndirectedStaticGraph::isDirected() const
+{
+	return false;
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#ifndef __UNDIRECTED_STATIC_GRAPH_HEADER_INCLUDED__
+#define __UNDIRECTED_STATIC_GRAPH_HEADER_INCLUDED__
+
+#include "../Static Graph/StaticGraph.h"
+
+class UndirectedStaticGraph : public StaticGraph
+{
+public:
+	explicit UndirectedStaticGraph(const String& id);
+
+	virtual bool isDirected() const override;
+};
+
+#endif //__UNDIRECTED_STATIC_GRAPH_HEADER_INCLUDED__
\ No newline at end of file
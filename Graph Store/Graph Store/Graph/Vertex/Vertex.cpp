@@ -1,8 +1,10 @@
 #include "Vertex.h"
 #include "../Graph Exception/GraphException.h"
 
-Vertex::Vertex(String id, size_t index) :
-	index(index)
+Vertex::Vertex(String id, size_t index, EdgeList::BoxAllocator& allocator) :
+	index(index),
+	edges(allocator),
+	incomingEdges(allocator)
 {
 	setID(std::move(id));
 }
@@ -24,6 +26,11 @@ const String& Vertex::getID() const
 	return id;
 }
 
+size_t Vertex::getIndex() const
+{
+	return index;
+}
+
 bool operator!=(const Vertex& lhs, const Vertex& rhs)
 {
 	return !(lhs == rhs);
@@ -2,8 +2,7 @@
 #define __VERTEX_HEADER_INCLUDED__
 
 #include "../../String/String.h"
-#include "../../Linked List/LinkedList.h"
-#include "../Edge/Edge.h"
+#include "../Edge List/EdgeList.h"
 
 class Vertex
 {
@@ -15,14 +14,16 @@ public:
 
 	const String& getID() const;
 	void setID(String id);
+	size_t getIndex() const;
 
 private:
-	Vertex(String id, size_t index);
+	Vertex(String id, size_t index, EdgeList::BoxAllocator& allocator);
 
 private:
 	String id;
 	size_t index;
-	LinkedList<Edge> edges;
+	EdgeList edges;
+	EdgeList incomingEdges;
 };
 
 bool operator==(const Vertex& lhs, const Vertex& rhs);
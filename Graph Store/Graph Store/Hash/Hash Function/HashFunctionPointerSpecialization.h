@@ -0,0 +1,34 @@
+/*
+	This class specialization hashes the address with the finaliser of
+	MurmurHash3, since the low bits of an address are mostly zeroes:
+	https://github.com/aappleby/smhasher/wiki/MurmurHash3
+*/
+
+#ifndef __HASH_FUNCTION_POINTER_SPECIALIZATION_HEADER_INCLUDED__
+#define __HASH_FUNCTION_POINTER_SPECIALIZATION_HEADER_INCLUDED__
+
+#include "HashFunction.h"
+#include <cstdint>
+
+template <class T>
+class HashFunction<T*>
+{
+	static const unsigned FIRST_MULTIPLIER = 0x85ebca6b;
+	static const unsigned SECOND_MULTIPLIER = 0xc2b2ae35;
+
+public:
+	unsigned operator()(T* key) const
+	{
+		unsigned hashValue = static_cast<unsigned>(reinterpret_cast<std::uintptr_t>(key));
+
+		hashValue ^= hashValue >> 16;
+		hashValue *= FIRST_MULTIPLIER;
+		hashValue ^= hashValue >> 13;
+		hashValue *= SECOND_MULTIPLIER;
+		hashValue ^= hashValue >> 16;
+
+		return hashValue;
+	}
+};
+
+#endif //__HASH_FUNCTION_POINTER_SPECIALIZATION_HEADER_INCLUDED__
\ No newline at end of file
@@ -267,6 +267,22 @@ const Item& Hash<Item, Key, KeyAccessor, Function>::operator[](const Key& key) c
 	}
 }
 
+template <class Item, class Key, class KeyAccessor, class Function>
+Item* Hash<Item, Key, KeyAccessor, Function>::search(const Key& key)
+{
+	long index = getIndexOfFirstItemWithKey(key);
+
+	return (index != -1) ? &table[index] : nullptr;
+}
+
+template <class Item, class Key, class KeyAccessor, class Function>
+const Item* Hash<Item, Key, KeyAccessor, Function>::search(const Key& key) const
+{
+	long index = getIndexOfFirstItemWithKey(key);
+
+	return (index != -1) ? &table[index] : nullptr;
+}
+
 template <class Item, class Key, class KeyAccessor, class Function>
 long Hash<Item, Key, KeyAccessor, Function>::getIndexOfFirstItemWithKey(const Key& key) const
 {
@@ -0,0 +1,287 @@
+#include "MappedFileParser.h"
+#include "../File Parser/File Parser Exception/FileParserException.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <assert.h>
+
+MappedFileParser::Token::Token(const char* first, size_t length) :
+	first(first),
+	length(length)
+{
+}
+
+const char* MappedFileParser::Token::getData() const
+{
+	return first;
+}
+
+size_t MappedFileParser::Token::getLength() const
+{
+	return length;
+}
+
+String MappedFileParser::Token::toString() const
+{
+	return String(first, length);
+}
+
+MappedFileParser::MappedFileParser() :
+	current(nullptr),
+	end(nullptr),
+	lineNumber(0),
+	hasFailed(false)
+{
+}
+
+MappedFileParser::MappedFileParser(const String& fileName) :
+	MappedFileParser()
+{
+	openFile(fileName);
+}
+
+MappedFileParser::MappedFileParser(MappedFileParser&& source) :
+	file(std::move(source.file)),
+	current(source.current),
+	end(source.end),
+	lineNumber(source.lineNumber),
+	hasFailed(source.hasFailed)
+{
+	source.current = nullptr;
+	source.end = nullptr;
+	source.lineNumber = 0;
+	source.hasFailed = false;
+}
+
+MappedFileParser& MappedFileParser::operator=(MappedFileParser&& rhs)
+{
+	if (this != &rhs)
+	{
+		swapContentsWith(std::move(rhs));
+	}
+
+	return *this;
+}
+
+void MappedFileParser::swapContentsWith(MappedFileParser parser)
+{
+	std::swap(file, parser.file);
+	std::swap(current, parser.current);
+	std::swap(end, parser.end);
+	std::swap(lineNumber, parser.lineNumber);
+	std::swap(hasFailed, parser.hasFailed);
+}
+
+void MappedFileParser::openFile(const String& fileName)
+{
+	if (hasOpenedFile())
+	{
+		closeFile();
+	}
+
+	file.open(fileName);
+	current = file.getContents();
+	end = current + file.getSize();
+	lineNumber = 1;
+	hasFailed = false;
+}
+
+bool MappedFileParser::hasOpenedFile() const
+{
+	return file.isOpened();
+}
+
+void MappedFileParser::closeFile()
+{
+	if (hasOpenedFile())
+	{
+		file.close();
+		current = nullptr;
+		end = nullptr;
+		lineNumber = 0;
+		hasFailed = false;
+	}
+}
+
+///
+/// The token does not include the new line character, nor a carriage
+/// return before it.
+///
+MappedFileParser::Token MappedFileParser::readLine()
+{
+	verifyValidState();
+
+	const char* newLine = static_cast<const char*>(memchr(current, '\n', end - current));
+	const char* lineEnd = (newLine != nullptr) ? newLine : end;
+	const char* contentEnd = (lineEnd != current && lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd;
+
+	Token line(current, contentEnd - current);
+	current = (newLine != nullptr) ? newLine + 1 : end;
+	++lineNumber;
+
+	return line;
+}
+
+void MappedFileParser::verifyValidState() const
+{
+	verifyAFileIsOpened();
+	verifyEndIsNotReached();
+	verifyNoPreviousOperationFailed();
+}
+
+void MappedFileParser::verifyAFileIsOpened() const
+{
+	if (!hasOpenedFile())
+	{
+		throw FileParserException(String("No file is currently opened!"));
+	}
+}
+
+void MappedFileParser::verifyEndIsNotReached() const
+{
+	if (hasReachedEnd())
+	{
+		throw FileParserException(String("End of file already reached!"));
+	}
+}
+
+void MappedFileParser::verifyNoPreviousOperationFailed() const
+{
+	if (hasFailed)
+	{
+		throw FileParserException(String("A previous operation already failed!"));
+	}
+}
+
+bool MappedFileParser::hasReachedEnd() const
+{
+	verifyAFileIsOpened();
+
+	return current == end;
+}
+
+void MappedFileParser::failWith(const char* message)
+{
+	assert(message != nullptr);
+
+	hasFailed = true;
+
+	std::string suffix = " Error at line " + std::to_string(lineNumber);
+	throw FileParserException(message + suffix);
+}
+
+///
+/// Does nothing at the end of the file, like FileParser, so that the last
+/// line of a file need not end with a new line.
+///
+void MappedFileParser::skipUntil(char character)
+{
+	verifyAFileIsOpened();
+	verifyNoPreviousOperationFailed();
+
+	if (hasReachedEnd())
+	{
+		return;
+	}
+
+	const char* found = static_cast<const char*>(memchr(current, character, end - current));
+	const char* stop = (found != nullptr) ? found + 1 : end;
+
+	countNewLinesUntil(stop);
+	current = stop;
+}
+
+void MappedFileParser::countNewLinesUntil(const char* position)
+{
+	assert(current <= position && position <= end);
+
+	lineNumber += static_cast<unsigned>(std::count(current, position, '\n'));
+}
+
+void MappedFileParser::skipSpaces()
+{
+	verifyValidState();
+
+	while (current != end && *current == ' ')
+	{
+		++current;
+	}
+}
+
+void MappedFileParser::skipWhitespace()
+{
+	while (current != end && isWhitespace(*current))
+	{
+		if (*current == '\n')
+		{
+			++lineNumber;
+		}
+
+		++current;
+	}
+}
+
+char MappedFileParser::peek()
+{
+	verifyValidState();
+
+	return *current;
+}
+
+///
+/// Parses the digits in place, failing like the stream extraction of
+/// FileParser on a number which does not fit in an unsigned.
+///
+unsigned MappedFileParser::parseUnsigned()
+{
+	verifyValidState();
+	skipWhitespace();
+	verifyNumberIsNonNegative();
+
+	if (current == end || !isDigit(*current))
+	{
+		failWith("Invalid number format!");
+	}
+
+	std::uint64_t number = 0;
+
+	do
+	{
+		number = 10 * number + (*current - '0');
+
+		if (number > UINT_MAX)
+		{
+			failWith("Invalid number format!");
+		}
+
+		++current;
+	} while (current != end && isDigit(*current));
+
+	return static_cast<unsigned>(number);
+}
+
+void MappedFileParser::verifyNumberIsNonNegative()
+{
+	if (current != end && *current == '-')
+	{
+		failWith("Number must not be negative!");
+	}
+}
+
+bool MappedFileParser::isWhitespace(char character)
+{
+	return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+}
+
+bool MappedFileParser::isDigit(char character)
+{
+	return character >= '0' && character <= '9';
+}
+
+char MappedFileParser::endOfFileCharacter()
+{
+	return EOF;
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef __MAPPED_FILE_PARSER_HEADER_INCLUDED__
+#define __MAPPED_FILE_PARSER_HEADER_INCLUDED__
+
+#include "../Mapped File/MappedFile.h"
+
+///
+/// A parser with the interface of FileParser which reads a file mapped
+/// into memory instead of a stream. The characters are scanned in place,
+/// so a line is returned as a token pointing into the mapping, and the
+/// searches for a character go through memchr, which the C runtime
+/// vectorises.
+///
+/// Whitespace before a number is skipped like the stream extraction of
+/// FileParser skips it, and a carriage return ending a line is not part of
+/// it.
+///
+class MappedFileParser
+{
+public:
+	///
+	/// A range of characters of the file. It is valid until the file is
+	/// closed.
+	///
+	class Token
+	{
+	public:
+		Token(const char* first, size_t length);
+
+		const char* getData() const;
+		size_t getLength() const;
+		String toString() const;
+
+	private:
+		const char* first;
+		size_t length;
+	};
+
+public:
+	static char endOfFileCharacter();
+
+public:
+	MappedFileParser();
+	explicit MappedFileParser(const String& fileName);
+	MappedFileParser(const MappedFileParser&) = delete;
+	MappedFileParser& operator=(const MappedFileParser&) = delete;
+	MappedFileParser(MappedFileParser&& source);
+	MappedFileParser& operator=(MappedFileParser&& rhs);
+	~MappedFileParser() = default;
+
+	void openFile(const String& fileName);
+	void closeFile();
+	bool hasReachedEnd() const;
+	bool hasOpenedFile() const;
+
+	Token readLine();
+	unsigned parseUnsigned();
+	char peek();
+	void skipUntil(char character);
+	void skipSpaces();
+
+private:
+	static bool isWhitespace(char character);
+	static bool isDigit(char character);
+
+private:
+	void skipWhitespace();
+	void countNewLinesUntil(const char* position);
+	void verifyValidState() const;
+	void verifyAFileIsOpened() const;
+	void verifyEndIsNotReached() const;
+	void verifyNoPreviousOperationFailed() const;
+	void verifyNumberIsNonNegative();
+	void failWith(const char* message);
+	void swapContentsWith(MappedFileParser parser);
+
+private:
+	MappedFile file;
+	const char* current;
+	const char* end;
+	unsigned lineNumber;
+	bool hasFailed;
+};
+
+#endif //__MAPPED_FILE_PARSER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "MappedFile.h"
+#include "../File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include <cstdint>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() :
+	contents(nullptr),
+	size(0),
+	isOpen(false)
+{
+}
+
+MappedFile::MappedFile(const String& fileName) :
+	MappedFile()
+{
+	open(fileName);
+}
+
+MappedFile::MappedFile(MappedFile&& source) :
+	contents(source.contents),
+	size(source.size),
+	isOpen(source.isOpen)
+{
+	source.contents = nullptr;
+	source.size = 0;
+	source.isOpen = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& rhs)
+{
+	if (this != &rhs)
+	{
+		swapContentsWith(std::move(rhs));
+	}
+
+	return *this;
+}
+
+void MappedFile::swapContentsWith(MappedFile file)
+{
+	std::swap(contents, file.contents);
+	std::swap(size, file.size);
+	std::swap(isOpen, file.isOpen);
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+void MappedFile::open(const String& fileName)
+{
+	close();
+	map(fileName);
+	isOpen = true;
+}
+
+void MappedFile::close()
+{
+	if (isOpen)
+	{
+		unmap();
+		contents = nullptr;
+		size = 0;
+		isOpen = false;
+	}
+}
+
+bool MappedFile::isOpened() const
+{
+	return isOpen;
+}
+
+const char* MappedFile::getContents() const
+{
+	return contents;
+}
+
+size_t MappedFile::getSize() const
+{
+	return size;
+}
+
+#ifdef _WIN32
+
+void MappedFile::map(const String& fileName)
+{
+	HANDLE file = CreateFileA(fileName.cString(),
+							  GENERIC_READ,
+							  FILE_SHARE_READ,
+							  nullptr,
+							  OPEN_EXISTING,
+							  FILE_FLAG_SEQUENTIAL_SCAN,
+							  nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		throw OpenFileFailException("Could not open file for reading, name: " + fileName);
+	}
+
+	LARGE_INTEGER fileSize;
+
+	if (!GetFileSizeEx(file, &fileSize) || static_cast<std::uint64_t>(fileSize.QuadPart) > SIZE_MAX)
+	{
+		CloseHandle(file);
+		throw OpenFileFailException("Could not map file into memory, name: " + fileName);
+	}
+
+	if (fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+
+	if (mapping == nullptr)
+	{
+		throw OpenFileFailException("Could not map file into memory, name: " + fileName);
+	}
+
+	contents = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	CloseHandle(mapping);
+
+	if (contents == nullptr)
+	{
+		throw OpenFileFailException("Could not map file into memory, name: " + fileName);
+	}
+
+	size = static_cast<size_t>(fileSize.QuadPart);
+}
+
+void MappedFile::unmap()
+{
+	if (contents != nullptr)
+	{
+		UnmapViewOfFile(contents);
+	}
+}
+
+///
+/// Windows has no hint to read a file which is not mapped yet, so nothing
+/// is done.
+///
+void MappedFile::prefetch(const String&)
+{
+}
+
+#else
+
+///
+/// The file is read from start to end once, so the kernel is told to read
+/// ahead aggressively and drop the pages behind.
+///
+void MappedFile::map(const String& fileName)
+{
+	int descriptor = ::open(fileName.cString(), O_RDONLY);
+
+	if (descriptor == -1)
+	{
+		throw OpenFileFailException("Could not open file for reading, name: " + fileName);
+	}
+
+	struct stat status;
+
+	if (fstat(descriptor, &status) == -1 || static_cast<std::uint64_t>(status.st_size) > SIZE_MAX)
+	{
+		::close(descriptor);
+		throw OpenFileFailException("Could not map file into memory, name: " + fileName);
+	}
+
+	size = static_cast<size_t>(status.st_size);
+
+	if (size == 0)
+	{
+		::close(descriptor);
+		return;
+	}
+
+	void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+	::close(descriptor);
+
+	if (address == MAP_FAILED)
+	{
+		size = 0;
+		throw OpenFileFailException("Could not map file into memory, name: " + fileName);
+	}
+
+	madvise(address, size, MADV_SEQUENTIAL);
+	contents = static_cast<const char*>(address);
+}
+
+void MappedFile::unmap()
+{
+	if (contents != nullptr)
+	{
+		munmap(const_cast<char*>(contents), size);
+	}
+}
+
+///
+/// Asks the kernel to start reading the file into the page cache without
+/// waiting for it, so that the file is read from the disk while others are
+/// being parsed. It is only a hint, so errors are ignored.
+///
+void MappedFile::prefetch(const String& fileName)
+{
+	int descriptor = ::open(fileName.cString(), O_RDONLY);
+
+	if (descriptor != -1)
+	{
+		posix_fadvise(descriptor, 0, 0, POSIX_FADV_WILLNEED);
+		::close(descriptor);
+	}
+}
+
+#endif
\ No newline at end of file
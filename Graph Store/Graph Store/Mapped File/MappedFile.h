@@ -0,0 +1,44 @@
+#ifndef __MAPPED_FILE_HEADER_INCLUDED__
+#define __MAPPED_FILE_HEADER_INCLUDED__
+
+#include "../String/String.h"
+
+///
+/// The contents of a file mapped into memory for reading. The handles of
+/// the file are closed as soon as it is mapped, since the mapping keeps it
+/// open on its own. An empty file cannot be mapped, so it is opened with
+/// no contents.
+///
+class MappedFile
+{
+public:
+	static void prefetch(const String& fileName);
+
+public:
+	MappedFile();
+	explicit MappedFile(const String& fileName);
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile(MappedFile&& source);
+	MappedFile& operator=(MappedFile&& rhs);
+	~MappedFile();
+
+	void open(const String& fileName);
+	void close();
+	bool isOpened() const;
+
+	const char* getContents() const;
+	size_t getSize() const;
+
+private:
+	void map(const String& fileName);
+	void unmap();
+	void swapContentsWith(MappedFile file);
+
+private:
+	const char* contents;
+	size_t size;
+	bool isOpen;
+};
+
+#endif //__MAPPED_FILE_HEADER_INCLUDED__
\ No newline at end of file
@@ -3,9 +3,12 @@
 
 class PriorityQueueHandle
 {
-	template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+	template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
 	friend class PriorityQueue;
 
+	template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+	friend class PairingHeap;
+
 public:
 	PriorityQueueHandle() :
 		PriorityQueueHandle(-1)
@@ -0,0 +1,96 @@
+#ifndef __PAIRING_HEAP_HEADER_INCLUDED__
+#define __PAIRING_HEAP_HEADER_INCLUDED__
+
+#include "../PriorityQueue.h"
+
+///
+/// A pairing heap with the interface of PriorityQueue. Adding an item and
+/// optimising its key only link trees together, in constant time, and the
+/// work is left to extractOptimal, which pairs the children of the root in
+/// two passes in amortised O(log n). It suits workloads which optimise
+/// keys far more often than they extract, like Dijkstra's algorithm on
+/// dense graphs.
+///
+/// The nodes are kept in an array and link to each other by index: to the
+/// first child, to the next sibling and to the previous one, or to the
+/// parent for a first child. The index of a node is the handle of its item
+/// and does not change while the item is in the heap. Freed nodes are
+/// reused by later additions.
+///
+template <class Item,
+	class Comparator = Less,
+	class Key = Item,
+	class KeyAccessor = IdentityKeyAccessor,
+	class HandleUpdator = EmptyMethodFunctor>
+class PairingHeap
+{
+	typedef PriorityQueueHandle Handle;
+
+	struct Node
+	{
+		Node(const Item& item = Item()) :
+			item(item),
+			child(NO_NODE),
+			sibling(NO_NODE),
+			previous(NO_NODE)
+		{
+		}
+
+		Item item;
+		long child;
+		long sibling;
+		long previous;
+	};
+
+public:
+	PairingHeap();
+
+	template <class Iterator>
+	PairingHeap(Iterator& iterator, size_t itemsCount);
+	PairingHeap(const PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&) = default;
+	PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&
+		operator=(const PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&) = default;
+	PairingHeap(PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&& source);
+	PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&
+		operator=(PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&& rhs);
+	~PairingHeap();
+
+	void add(const Item& item);
+	Item extractOptimal();
+	Item getOptimal() const;
+	void optimiseKey(const Handle& handle, const Key& newKey);
+	void empty();
+	bool isEmpty() const;
+
+private:
+	static const long NO_NODE = -1;
+	static const long FREE_NODE = -2;
+
+private:
+	static HandleUpdator handleUpdator;
+	static KeyAccessor keyAccessor;
+	static Comparator comparator;
+
+private:
+	long allocateNodeFor(const Item& item);
+	void freeNode(long node);
+	long meld(long first, long second);
+	long mergePairs(long firstSibling);
+	void cut(long node);
+	void detach(long node);
+	bool hasOptimalKey(long node, long other) const;
+	void invalidateAllHandles();
+	void verifyQueueIsNotEmpty() const;
+	void verifyHandleValidity(const Handle& h) const;
+	bool isFree(long node) const;
+	void swapContentsWith(PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>& heap);
+
+private:
+	DynamicArray<Node> nodes;
+	long root;
+	long firstFreeNode;
+};
+
+#include "PairingHeap.hpp"
+
+#endif //__PAIRING_HEAP_HEADER_INCLUDED__
\ No newline at end of file
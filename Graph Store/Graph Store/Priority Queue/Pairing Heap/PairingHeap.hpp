@@ -0,0 +1,328 @@
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+HandleUpdator PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::handleUpdator;
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+KeyAccessor PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::keyAccessor;
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+Comparator PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::comparator;
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::PairingHeap() :
+	root(NO_NODE),
+	firstFreeNode(NO_NODE)
+{
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+template <class Iterator>
+PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::PairingHeap(Iterator& iterator,
+																		  size_t itemsCount) :
+	PairingHeap()
+{
+	nodes.ensureSize(itemsCount);
+
+	for (size_t i = 1; i <= itemsCount; ++i)
+	{
+		add(*iterator);
+		++iterator;
+	}
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::PairingHeap(
+	PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&& source) :
+	PairingHeap()
+{
+	swapContentsWith(source);
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&
+PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::operator=(
+	PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>&& rhs)
+{
+	if (this != &rhs)
+	{
+		empty();
+		swapContentsWith(rhs);
+	}
+
+	return *this;
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::swapContentsWith(
+	PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>& heap)
+{
+	std::swap(nodes, heap.nodes);
+	std::swap(root, heap.root);
+	std::swap(firstFreeNode, heap.firstFreeNode);
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::~PairingHeap()
+{
+	invalidateAllHandles();
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::empty()
+{
+	invalidateAllHandles();
+	nodes.empty();
+	root = NO_NODE;
+	firstFreeNode = NO_NODE;
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::invalidateAllHandles()
+{
+	size_t count = nodes.getCount();
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!isFree(i))
+		{
+			handleUpdator(nodes[i].item, Handle());
+		}
+	}
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::add(const Item& item)
+{
+	long node = allocateNodeFor(item);
+
+	handleUpdator(nodes[node].item, Handle(node));
+	root = meld(root, node);
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+long PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::allocateNodeFor(const Item& item)
+{
+	if (firstFreeNode == NO_NODE)
+	{
+		nodes.add(Node(item));
+
+		return static_cast<long>(nodes.getCount() - 1);
+	}
+
+	long node = firstFreeNode;
+	firstFreeNode = nodes[node].sibling;
+	nodes[node] = Node(item);
+
+	return node;
+}
+
+///
+/// The free nodes form a list through their sibling links.
+///
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::freeNode(long node)
+{
+	nodes[node].item = Item();
+	nodes[node].child = NO_NODE;
+	nodes[node].previous = FREE_NODE;
+	nodes[node].sibling = firstFreeNode;
+	firstFreeNode = node;
+}
+
+///
+/// Links the roots of two trees, making the one with the worse key the
+/// first child of the other. Returns the root of the resulting tree.
+///
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+long PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::meld(long first, long second)
+{
+	if (first == NO_NODE)
+	{
+		return second;
+	}
+	else if (second == NO_NODE)
+	{
+		return first;
+	}
+
+	if (hasOptimalKey(second, first))
+	{
+		std::swap(first, second);
+	}
+
+	Node& parent = nodes[first];
+	Node& child = nodes[second];
+
+	child.sibling = parent.child;
+	child.previous = first;
+
+	if (parent.child != NO_NODE)
+	{
+		nodes[parent.child].previous = second;
+	}
+
+	parent.child = second;
+
+	return first;
+}
+
+///
+/// Melds the siblings in pairs from left to right and then melds the
+/// resulting trees from right to left. The trees of the first pass are
+/// stacked through their sibling links, so no extra memory is needed.
+///
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+long PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::mergePairs(long firstSibling)
+{
+	long pairs = NO_NODE;
+
+	while (firstSibling != NO_NODE)
+	{
+		long first = firstSibling;
+		long second = nodes[first].sibling;
+		firstSibling = (second != NO_NODE) ? nodes[second].sibling : NO_NODE;
+
+		detach(first);
+
+		if (second != NO_NODE)
+		{
+			detach(second);
+		}
+
+		long pair = meld(first, second);
+		nodes[pair].sibling = pairs;
+		pairs = pair;
+	}
+
+	long result = NO_NODE;
+
+	while (pairs != NO_NODE)
+	{
+		long pair = pairs;
+		pairs = nodes[pair].sibling;
+		nodes[pair].sibling = NO_NODE;
+
+		result = meld(result, pair);
+	}
+
+	return result;
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::detach(long node)
+{
+	nodes[node].sibling = NO_NODE;
+	nodes[node].previous = NO_NODE;
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline bool PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::hasOptimalKey(long node, long other) const
+{
+	return comparator(keyAccessor.getKeyOf(nodes[node].item), keyAccessor.getKeyOf(nodes[other].item));
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline Item PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::getOptimal() const
+{
+	verifyQueueIsNotEmpty();
+
+	return nodes[root].item;
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+Item PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::extractOptimal()
+{
+	verifyQueueIsNotEmpty();
+
+	long oldRoot = root;
+	Item optimal = nodes[oldRoot].item;
+	handleUpdator(nodes[oldRoot].item, Handle());
+
+	root = mergePairs(nodes[oldRoot].child);
+	freeNode(oldRoot);
+
+	return optimal;
+}
+
+///
+/// The node is cut from its parent together with its subtree and melded
+/// with the root, unless it is the root itself.
+///
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::optimiseKey(const Handle& handle,
+																			   const Key& newKey)
+{
+	verifyHandleValidity(handle);
+
+	long node = handle.index;
+	Item& item = nodes[node].item;
+
+	if (comparator(keyAccessor.getKeyOf(item), newKey))
+	{
+		throw std::invalid_argument("The key can't be worsened!");
+	}
+
+	keyAccessor.setKeyOfWith(item, newKey);
+
+	if (node != root)
+	{
+		cut(node);
+		root = meld(root, node);
+	}
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::cut(long node)
+{
+	Node& cutNode = nodes[node];
+	Node& previous = nodes[cutNode.previous];
+
+	if (previous.child == node)
+	{
+		previous.child = cutNode.sibling;
+	}
+	else
+	{
+		previous.sibling = cutNode.sibling;
+	}
+
+	if (cutNode.sibling != NO_NODE)
+	{
+		nodes[cutNode.sibling].previous = cutNode.previous;
+	}
+
+	detach(node);
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::verifyHandleValidity(const Handle& h) const
+{
+	if (!h.isValid())
+	{
+		throw std::invalid_argument("Invalid handle!");
+	}
+
+	assert(h.index >= 0);
+	assert(static_cast<size_t>(h.index) < nodes.getCount());
+	assert(!isFree(h.index));
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline void PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::verifyQueueIsNotEmpty() const
+{
+	if (isEmpty())
+	{
+		throw std::logic_error("The queue is empty!");
+	}
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline bool PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::isFree(long node) const
+{
+	return nodes[node].previous == FREE_NODE;
+}
+
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+inline bool PairingHeap<Item, Comparator, Key, KeyAccessor, HandleUpdator>::isEmpty() const
+{
+	return root == NO_NODE;
+}
\ No newline at end of file
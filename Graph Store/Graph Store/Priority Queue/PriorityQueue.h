@@ -23,7 +23,7 @@ public:
 	}
 };
 
-class Identity
+class IdentityKeyAccessor
 {
 public:
 	template <class Item>
@@ -39,13 +39,25 @@ public:
 	}
 };
 
+///
+/// A d-ary heap of items, binary by default. A larger Arity makes the heap
+/// shallower, so adding an item or optimising its key, which sift it up,
+/// take fewer steps, while extracting compares the Arity children of each
+/// node on the way down. The children of a node are adjacent in the array.
+///
+/// The HandleUpdator is told the position of an item whenever it moves,
+/// so its key can be optimised later through the handle.
+///
 template <class Item,
 	class Comparator = Less,
 	class Key = Item,
-	class KeyAccessor = Identity,
-	class HandleUpdator = EmptyMethodFunctor>
+	class KeyAccessor = IdentityKeyAccessor,
+	class HandleUpdator = EmptyMethodFunctor,
+	size_t Arity = 2>
 class PriorityQueue
 {
+	static_assert(Arity >= 2, "A heap node must have at least two children!");
+
 	typedef PriorityQueueHandle Handle;
 
 	class Element
@@ -76,12 +88,12 @@ public:
 
 	template <class Iterator>
 	PriorityQueue(Iterator& iterator, size_t itemsCount);
-	PriorityQueue(const PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>&) = default;
-	PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>&
-		operator=(const PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>&) = default;
-	PriorityQueue(PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>&&) = default;
-	PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>&
-		operator=(PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>&& rhs);
+	PriorityQueue(const PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>&) = default;
+	PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>&
+		operator=(const PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>&) = default;
+	PriorityQueue(PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>&&) = default;
+	PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>&
+		operator=(PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>&& rhs);
 	~PriorityQueue();
 
 	void add(const Item& item);
@@ -92,7 +104,7 @@ public:
 	bool isEmpty() const;
 
 private:
-	static size_t computeLeftChildOf(size_t index);
+	static size_t computeFirstChildOf(size_t index);
 	static size_t computeParentOf(size_t index);
 	static bool isRoot(size_t index);
 
@@ -104,13 +116,13 @@ private:
 	void addAtEnd(const Element& element);
 	void setElementAtWith(size_t index, const Element& element);
 	void invalidateAllHandles();
-	size_t computeOptimalKeySuccessor(size_t leftSuccessor) const;
+	size_t computeOptimalKeySuccessor(size_t firstSuccessor) const;
 	bool isWithinHeap(size_t index) const;
 	template <class Iterator>
 	void copyItems(Iterator& iterator, size_t itemsCount);
 	void verifyQueueIsNotEmpty() const;
 	void verifyHandleValidity(const Handle& h) const;
-	void swapContentsWith(PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator> queue);
+	void swapContentsWith(PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity> queue);
 
 private:
 	DynamicArray<Element> elements;
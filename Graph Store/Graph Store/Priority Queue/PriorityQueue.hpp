@@ -1,34 +1,34 @@
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-HandleUpdator PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::handleUpdator;
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+HandleUpdator PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::handleUpdator;
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-KeyAccessor PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::keyAccessor;
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+KeyAccessor PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::keyAccessor;
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-Comparator PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::comparator;
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+Comparator PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::comparator;
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::Element(const Item& item) :
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::Element(const Item& item) :
 	item(item)
 {
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline bool PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::compare(const Element& lhs,
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline bool PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::compare(const Element& lhs,
 																							   const Element& rhs)
 {
 	return comparator(lhs.getKey(), rhs.getKey());
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline const Key& PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::getKey() const
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline const Key& PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::getKey() const
 {
 	return keyAccessor.getKeyOf(item);
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::optimiseKey(const Key& newKey)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::optimiseKey(const Key& newKey)
 {
 	if (!comparator(getKey(), newKey))
 	{
@@ -40,27 +40,27 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::
 	}
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::invalidateHandle()
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::invalidateHandle()
 {
 	setHandle(Handle());
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::setHandle(const Handle& handle)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::setHandle(const Handle& handle)
 {
 	handleUpdator(item, handle);
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline const Item& PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::Element::getItem() const
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline const Item& PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::Element::getItem() const
 {
 	return item;
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
 template <class Iterator>
-PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::PriorityQueue(Iterator& iterator,
+PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::PriorityQueue(Iterator& iterator,
 																				size_t itemsCount) :
 	PriorityQueue()
 {
@@ -68,9 +68,9 @@ PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::PriorityQueue(
 	buildHeap();
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
 template <class Iterator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::copyItems(Iterator& iterator,
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::copyItems(Iterator& iterator,
 																				 size_t itemsCount)
 {
 	elements.ensureSize(itemsCount);
@@ -82,8 +82,8 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::copyItems
 	}
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::addAtEnd(const Element& element)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::addAtEnd(const Element& element)
 {
 	elements.add(element);
 
@@ -91,20 +91,27 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::addAtEnd(
 	elements[lastIndex].setHandle(Handle(lastIndex));
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::buildHeap()
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::buildHeap()
 {
-	for (long nonLeaf = (elements.getCount() / 2) - 1; nonLeaf >= 0; --nonLeaf)
+	size_t count = elements.getCount();
+
+	if (count < 2)
+	{
+		return;
+	}
+
+	for (long nonLeaf = static_cast<long>(computeParentOf(count - 1)); nonLeaf >= 0; --nonLeaf)
 	{
 		siftDownElementAt(nonLeaf);
 	}
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::siftDownElementAt(size_t index)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::siftDownElementAt(size_t index)
 {
 	Element elementToMove = elements[index];
-	size_t successor = computeLeftChildOf(index);
+	size_t successor = computeFirstChildOf(index);
 
 	while (isWithinHeap(successor))
 	{
@@ -120,31 +127,33 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::siftDownE
 			break;
 		}
 
-		successor = computeLeftChildOf(index);
+		successor = computeFirstChildOf(index);
 	}
 
 	setElementAtWith(index, elementToMove);
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-size_t PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::computeOptimalKeySuccessor(size_t leftSuccessor) const
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+size_t PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::computeOptimalKeySuccessor(size_t firstSuccessor) const
 {
-	assert(isWithinHeap(leftSuccessor));
-	size_t rightSuccessor = leftSuccessor + 1;
+	assert(isWithinHeap(firstSuccessor));
 
-	if (isWithinHeap(rightSuccessor)
-		&& Element::compare(elements[rightSuccessor], elements[leftSuccessor]))
-	{
-		return rightSuccessor;
-	}
-	else
+	size_t optimalSuccessor = firstSuccessor;
+	size_t lastSuccessor = firstSuccessor + Arity - 1;
+
+	for (size_t successor = firstSuccessor + 1; successor <= lastSuccessor && isWithinHeap(successor); ++successor)
 	{
-		return leftSuccessor;
+		if (Element::compare(elements[successor], elements[optimalSuccessor]))
+		{
+			optimalSuccessor = successor;
+		}
 	}
+
+	return optimalSuccessor;
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::setElementAtWith(size_t index,
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::setElementAtWith(size_t index,
 																							   const Element& element)
 {
 	assert(isWithinHeap(index));
@@ -153,10 +162,10 @@ inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::se
 	elements[index].setHandle(Handle(index));
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>&
-PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::operator=(
-	PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>&& rhs)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>&
+PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::operator=(
+	PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>&& rhs)
 {
 	if (this != &rhs)
 	{
@@ -167,8 +176,8 @@ PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::operator=(
 	return *this;
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::invalidateAllHandles()
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::invalidateAllHandles()
 {
 	size_t count = elements.getCount();
 
@@ -178,28 +187,28 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::invalidat
 	}
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::swapContentsWith(
-	PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator> queue)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::swapContentsWith(
+	PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity> queue)
 {
 	std::swap(elements, queue.elements);
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::~PriorityQueue()
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::~PriorityQueue()
 {
 	invalidateAllHandles();
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::empty()
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::empty()
 {
 	invalidateAllHandles();
 	elements.empty();
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::optimiseKey(const Handle& handle,
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::optimiseKey(const Handle& handle,
 																				   const Key& newKey)
 {
 	verifyHandleValidity(handle);
@@ -208,8 +217,8 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::optimiseK
 	siftUpElementAt(handle.index);
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::verifyHandleValidity(const Handle& h) const
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::verifyHandleValidity(const Handle& h) const
 {
 	if (!h.isValid())
 	{
@@ -220,8 +229,8 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::verifyHan
 	assert(isWithinHeap(h.index));
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::siftUpElementAt(size_t index)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::siftUpElementAt(size_t index)
 {
 	Element elementToMove = elements[index];
 	size_t parent;
@@ -244,23 +253,23 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::siftUpEle
 	setElementAtWith(index, elementToMove);
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::add(const Item& item)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::add(const Item& item)
 {
 	addAtEnd(Element(item));
 	siftUpElementAt(elements.getCount() - 1);
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline Item PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::getOptimal() const
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline Item PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::getOptimal() const
 {
 	verifyQueueIsNotEmpty();
 
 	return elements[0].getItem();
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::verifyQueueIsNotEmpty() const
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::verifyQueueIsNotEmpty() const
 {
 	if (isEmpty())
 	{
@@ -268,8 +277,8 @@ inline void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::ve
 	}
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-Item PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::extractOptimal()
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+Item PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::extractOptimal()
 {
 	verifyQueueIsNotEmpty();
 
@@ -285,8 +294,8 @@ Item PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::extractOp
 	return optimal;
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::moveLastElementAtTopOfHeap()
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::moveLastElementAtTopOfHeap()
 {
 	assert(!isEmpty());
 
@@ -295,34 +304,34 @@ void PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::moveLastE
 	elements.removeAt(indexOfLastElement);
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline bool PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::isEmpty() const
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline bool PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::isEmpty() const
 {
 	return elements.isEmpty();
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline bool PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::isWithinHeap(size_t index) const
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline bool PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::isWithinHeap(size_t index) const
 {
 	return index < elements.getCount();
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline size_t PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::computeLeftChildOf(size_t index)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline size_t PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::computeFirstChildOf(size_t index)
 {
-	return (2 * index) + 1;
+	return (Arity * index) + 1;
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline size_t PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::computeParentOf(size_t index)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline size_t PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::computeParentOf(size_t index)
 {
 	assert(index > 0);
 
-	return (index - 1) / 2;
+	return (index - 1) / Arity;
 }
 
-template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator>
-inline bool PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator>::isRoot(size_t index)
+template <class Item, class Comparator, class Key, class KeyAccessor, class HandleUpdator, size_t Arity>
+inline bool PriorityQueue<Item, Comparator, Key, KeyAccessor, HandleUpdator, Arity>::isRoot(size_t index)
 {
 	return index == 0;
 }
@@ -0,0 +1,66 @@
+#ifndef __RADIX_HEAP_HEADER_INCLUDED__
+#define __RADIX_HEAP_HEADER_INCLUDED__
+
+#include <climits>
+#include <vector>
+
+///
+/// A monotone priority queue for unsigned integer keys. The items are kept
+/// in buckets by the highest bit in which their keys differ from the last
+/// extracted key: bucket 0 holds the items with that very key and bucket
+/// i > 0 those whose key differs from it in bit i - 1 first.
+///
+/// When bucket 0 runs out, the first non-empty bucket is emptied into the
+/// lower ones around its lowest key, which becomes the new last key. An item
+/// only moves to lower buckets, so an extraction costs amortised
+/// O(log C), where C is the largest difference between the keys in the
+/// heap, independently of the number of items.
+///
+/// The keys must not be lower than the last extracted one. There is no
+/// decrease-key: an item is added again with its lower key and the stale
+/// entry is skipped by the caller when extracted.
+///
+template <class Item>
+class RadixHeap
+{
+	struct Entry
+	{
+		unsigned key;
+		Item item;
+	};
+
+	typedef std::vector<Entry> Bucket;
+
+public:
+	RadixHeap();
+	RadixHeap(const RadixHeap<Item>&) = default;
+	RadixHeap<Item>& operator=(const RadixHeap<Item>&) = default;
+	~RadixHeap() = default;
+
+	void add(const Item& item, unsigned key);
+	Item extractOptimal();
+	unsigned getOptimalKey();
+	void empty();
+	bool isEmpty() const;
+
+private:
+	static const size_t BUCKETS_COUNT = sizeof(unsigned) * CHAR_BIT + 1;
+
+private:
+	static size_t findHighestBitOf(unsigned bits);
+
+private:
+	size_t getBucketIndexOf(unsigned key) const;
+	void refillFirstBucket();
+	void verifyKeyIsNotBelowLastKey(unsigned key) const;
+	void verifyHeapIsNotEmpty() const;
+
+private:
+	Bucket buckets[BUCKETS_COUNT];
+	size_t itemsCount;
+	unsigned lastKey;
+};
+
+#include "RadixHeap.hpp"
+
+#endif //__RADIX_HEAP_HEADER_INCLUDED__
\ No newline at end of file
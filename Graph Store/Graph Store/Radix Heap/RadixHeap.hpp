@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <stdexcept>
+
+template <class Item>
+RadixHeap<Item>::RadixHeap() :
+	itemsCount(0),
+	lastKey(0)
+{
+}
+
+template <class Item>
+void RadixHeap<Item>::add(const Item& item, unsigned key)
+{
+	verifyKeyIsNotBelowLastKey(key);
+
+	buckets[getBucketIndexOf(key)].push_back({ key, item });
+	++itemsCount;
+}
+
+template <class Item>
+inline void RadixHeap<Item>::verifyKeyIsNotBelowLastKey(unsigned key) const
+{
+	if (key < lastKey)
+	{
+		throw std::invalid_argument("The key is lower than the last extracted one!");
+	}
+}
+
+template <class Item>
+inline size_t RadixHeap<Item>::getBucketIndexOf(unsigned key) const
+{
+	return (key == lastKey) ? 0 : findHighestBitOf(key ^ lastKey) + 1;
+}
+
+template <class Item>
+size_t RadixHeap<Item>::findHighestBitOf(unsigned bits)
+{
+	size_t highestBit = 0;
+
+	for (size_t shift = sizeof(unsigned) * CHAR_BIT / 2; shift > 0; shift /= 2)
+	{
+		if (bits >> shift != 0)
+		{
+			bits >>= shift;
+			highestBit += shift;
+		}
+	}
+
+	return highestBit;
+}
+
+template <class Item>
+Item RadixHeap<Item>::extractOptimal()
+{
+	refillFirstBucket();
+
+	Item optimal = buckets[0].back().item;
+	buckets[0].pop_back();
+	--itemsCount;
+
+	return optimal;
+}
+
+template <class Item>
+unsigned RadixHeap<Item>::getOptimalKey()
+{
+	refillFirstBucket();
+
+	return lastKey;
+}
+
+///
+/// The keys in the first non-empty bucket agree with the last key above
+/// its bit, so they differ from their minimum only in lower bits and all
+/// of them move to lower buckets.
+///
+template <class Item>
+void RadixHeap<Item>::refillFirstBucket()
+{
+	verifyHeapIsNotEmpty();
+
+	if (!buckets[0].empty())
+	{
+		return;
+	}
+
+	size_t index = 1;
+
+	while (buckets[index].empty())
+	{
+		++index;
+	}
+
+	Bucket& bucket = buckets[index];
+
+	lastKey = std::min_element(bucket.cbegin(), bucket.cend(), [](const Entry& lhs, const Entry& rhs)
+	{
+		return lhs.key < rhs.key;
+	})->key;
+
+	for (const Entry& entry : bucket)
+	{
+		buckets[getBucketIndexOf(entry.key)].push_back(entry);
+	}
+
+	bucket.clear();
+}
+
+template <class Item>
+inline void RadixHeap<Item>::verifyHeapIsNotEmpty() const
+{
+	if (isEmpty())
+	{
+		throw std::logic_error("The heap is empty!");
+	}
+}
+
+template <class Item>
+void RadixHeap<Item>::empty()
+{
+	for (Bucket& bucket : buckets)
+	{
+		bucket.clear();
+	}
+
+	itemsCount = 0;
+	lastKey = 0;
+}
+
+template <class Item>
+inline bool RadixHeap<Item>::isEmpty() const
+{
+	return itemsCount == 0;
+}
\ No newline at end of file
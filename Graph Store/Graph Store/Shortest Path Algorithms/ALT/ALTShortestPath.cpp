@@ -0,0 +1,147 @@
+#include "ALTShortestPath.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include "../Landmarks/Landmarks.h"
+#include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
+
+static ShortestPathAlgorithmRegistrator<ALTShortestPath> registrator("alt");
+
+ALTShortestPath::ALTShortestPath(const String& id) :
+	ShortestPathAlgorithm(id),
+	landmarks(nullptr),
+	target(nullptr)
+{
+}
+
+void ALTShortestPath::initialise(const Graph& graph,
+								 const Vertex& source,
+								 const Vertex& target)
+{
+	decorateVerticesOf(graph);
+
+	this->landmarks = graph.getLandmarks();
+	this->target = &target;
+
+	addSourceToUndeterminedEstimateVertices(source);
+}
+
+void ALTShortestPath::decorateVerticesOf(const Graph& graph)
+{
+	decoratedVertices.startNewSession(graph.getVerticesCount());
+}
+
+ALTShortestPath::ALTVertex& ALTShortestPath::getDecoratedVersionOf(const Vertex& v)
+{
+	return decoratedVertices[v];
+}
+
+void ALTShortestPath::addSourceToUndeterminedEstimateVertices(const Vertex& source)
+{
+	ALTVertex& decoratedSource = getDecoratedVersionOf(source);
+
+	initialiseSource(decoratedSource);
+
+	const Distance& lowerBound = getLowerBoundToTargetOf(decoratedSource);
+
+	if (isFinite(lowerBound))
+	{
+		decoratedSource.estimate = lowerBound;
+		undeterminedEstimateVertices.add(&decoratedSource);
+	}
+}
+
+const Distance& ALTShortestPath::getLowerBoundToTargetOf(ALTVertex& v)
+{
+	if (!v.hasLowerBound)
+	{
+		v.lowerBoundToTarget = (landmarks != nullptr)
+			? landmarks->getLowerBoundOfDistanceBetween(*v.originalVertex, *target)
+			: Distance(0);
+		v.hasLowerBound = true;
+	}
+
+	return v.lowerBoundToTarget;
+}
+
+void ALTShortestPath::execute(const Graph& graph,
+							  const Vertex& source,
+							  const Vertex& target)
+{
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		searchIn(concreteGraph);
+	});
+}
+
+template <class ConcreteGraph>
+void ALTShortestPath::searchIn(const ConcreteGraph& graph)
+{
+	ALTVertex* v;
+
+	while (!undeterminedEstimateVertices.isEmpty())
+	{
+		v = undeterminedEstimateVertices.extractOptimal();
+
+		if (v->originalVertex == target)
+		{
+			return;
+		}
+
+		relaxEdgesLeaving(*v, graph);
+	}
+}
+
+template <class ConcreteGraph>
+void ALTShortestPath::relaxEdgesLeaving(const ALTVertex& start,
+										const ConcreteGraph& graph)
+{
+	graph.forEachEdgeLeaving(*start.originalVertex, [&](const Edge& e)
+	{
+		ALTVertex& end = getDecoratedVersionOf(e.getVertex());
+
+		relaxEdge(start, end, e.getWeight());
+	});
+}
+
+void ALTShortestPath::relaxEdge(const ALTVertex& start,
+								ALTVertex& end,
+								unsigned weight)
+{
+	Distance distanceThroughStart = start.distanceToSource + weight;
+
+	if (distanceThroughStart < end.distanceToSource)
+	{
+		const Distance& lowerBound = getLowerBoundToTargetOf(end);
+
+		if (!isFinite(lowerBound))
+		{
+			return;
+		}
+
+		end.distanceToSource = distanceThroughStart;
+
+		if (end.parent == nullptr)
+		{
+			end.estimate = distanceThroughStart + lowerBound;
+			undeterminedEstimateVertices.add(&end);
+		}
+		else
+		{
+			undeterminedEstimateVertices.optimiseKey(end.handle, distanceThroughStart + lowerBound);
+		}
+
+		end.parent = &start;
+	}
+}
+
+///
+/// Distance::operator== does not consider infinity equal to itself.
+///
+bool ALTShortestPath::isFinite(const Distance& d)
+{
+	return d < Distance::getInfinity();
+}
+
+void ALTShortestPath::cleanUp()
+{
+	undeterminedEstimateVertices.empty();
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#ifndef __ALT_SHORTEST_PATH_HEADER_INCLUDED__
+#define __ALT_SHORTEST_PATH_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../Decorated Vertices/DecoratedVertices.h"
+#include "../../Priority Queue/PriorityQueue.h"
+
+class Landmarks;
+
+///
+/// A* search which bounds the distance from a vertex to the target from
+/// below with the landmarks of the graph (see PREPROCESS-LANDMARKS). The
+/// bounds are consistent, so each vertex is determined at most once, as
+/// in Dijkstra's algorithm. Vertices which provably do not reach the target
+/// are never put in the queue.
+///
+/// On a graph without landmarks every bound is 0 and the search is
+/// Dijkstra's algorithm.
+///
+class ALTShortestPath : public ShortestPathAlgorithm
+{
+	struct ALTVertex : public DecoratedVertex
+	{
+		ALTVertex(const Vertex* originalVertex = nullptr) :
+			DecoratedVertex(originalVertex),
+			estimate(Distance::getInfinity()),
+			hasLowerBound(false)
+		{
+		}
+
+		PriorityQueueHandle handle;
+		Distance estimate;
+		Distance lowerBoundToTarget;
+		bool hasLowerBound;
+	};
+
+	class KeyAccessor
+	{
+	public:
+		const Distance& getKeyOf(const ALTVertex* v) const
+		{
+			return v->estimate;
+		}
+
+		void setKeyOfWith(ALTVertex* v, const Distance& d) const
+		{
+			v->estimate = d;
+		}
+	};
+
+	class HandleUpdator
+	{
+	public:
+		void operator()(ALTVertex* v, const PriorityQueueHandle& h) const
+		{
+			v->handle = h;
+		}
+	};
+
+	typedef PriorityQueue<ALTVertex*, Less, Distance, KeyAccessor, HandleUpdator, 4> PriorityQueue;
+
+public:
+	explicit ALTShortestPath(const String& id);
+	ALTShortestPath(const ALTShortestPath&) = delete;
+	ALTShortestPath& operator=(const ALTShortestPath&) = delete;
+
+private:
+	static bool isFinite(const Distance& d);
+
+private:
+	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void cleanUp() override;
+	virtual ALTVertex& getDecoratedVersionOf(const Vertex& vertex) override;
+	void decorateVerticesOf(const Graph& graph);
+	void addSourceToUndeterminedEstimateVertices(const Vertex& source);
+	void relaxEdge(const ALTVertex& start, ALTVertex& end, unsigned weight);
+	const Distance& getLowerBoundToTargetOf(ALTVertex& v);
+
+	template <class ConcreteGraph>
+	void searchIn(const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void relaxEdgesLeaving(const ALTVertex& vertex, const ConcreteGraph& graph);
+
+private:
+	PriorityQueue undeterminedEstimateVertices;
+	DecoratedVertices<ALTVertex> decoratedVertices;
+	const Landmarks* landmarks;
+	const Vertex* target;
+};
+
+#endif //__ALT_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
@@ -13,6 +13,12 @@ ShortestPathAlgorithm::Path::Path(const DecoratedVertex& source, const Decorated
 	}
 }
 
+ShortestPathAlgorithm::Path::Path(std::forward_list<String>&& identifiers, const Distance& length) :
+	identifiers(std::move(identifiers)),
+	length(length)
+{
+}
+
 bool ShortestPathAlgorithm::Path::existsPathBetween(const DecoratedVertex& source,
 													const DecoratedVertex& target)
 {
@@ -26,7 +32,7 @@ void ShortestPathAlgorithm::Path::collectIdentifiersOnThePath(const DecoratedVer
 
 	while (current != nullptr)
 	{
-		identifiers.push_front(current->originalVertex.getID());
+		identifiers.push_front(current->originalVertex->getID());
 
 		current = current->parent;
 	}
@@ -86,6 +92,21 @@ void ShortestPathAlgorithm::Path::printLength(std::ostream& out) const
 	out << "Path length: " << length << ".\n";
 }
 
+///
+/// An estimate, which counts each identifier in the list with its node.
+///
+size_t ShortestPathAlgorithm::Path::getMemoryUsage() const
+{
+	size_t usage = sizeof(Path);
+
+	std::for_each(identifiers.cbegin(), identifiers.cend(), [&](const String& id)
+	{
+		usage += sizeof(void*) + sizeof(String) + id.getLength() + 1;
+	});
+
+	return usage;
+}
+
 ShortestPathAlgorithm::ShortestPathAlgorithm(const String& id)
 {
 	setID(id);
@@ -133,14 +154,6 @@ ShortestPathAlgorithm::createPathBetween(const Vertex& source, const Vertex& tar
 	return Path(decoratedSource, decoratedTarget);
 }
 
-void ShortestPathAlgorithm::decorateVerticesOf(const Graph& graph)
-{
-	forEach(graph.getConstIteratorOfVertices(), [&](const Vertex* vertex)
-	{
-		addDecoratedVersionOf(*vertex);
-	});
-}
-
 void ShortestPathAlgorithm::initialiseSource(DecoratedVertex& source)
 {
 	source.parent = nullptr;
@@ -151,3 +164,12 @@ const String& ShortestPathAlgorithm::getID() const
 {
 	return id;
 }
+
+///
+/// Whether the paths found are the shortest by the sum of the weights of
+/// their edges, rather than by the number of their edges.
+///
+bool ShortestPathAlgorithm::findsWeightedShortestPaths() const
+{
+	return true;
+}
@@ -13,14 +13,14 @@ class ShortestPathAlgorithm
 protected:
 	struct DecoratedVertex
 	{
-		DecoratedVertex(const Vertex& originalVertex) :
+		DecoratedVertex(const Vertex* originalVertex = nullptr) :
 			originalVertex(originalVertex),
 			parent(nullptr),
 			distanceToSource(Distance::getInfinity())
 		{
 		}
 
-		const Vertex& originalVertex;
+		const Vertex* originalVertex;
 		const DecoratedVertex* parent;
 		Distance distanceToSource;
 	};
@@ -29,6 +29,9 @@ public:
 	class Path
 	{
 		friend class ShortestPathAlgorithm;
+		friend class ShortestPathTree;
+		friend class AllPairsShortestPaths;
+		friend class DynamicShortestPathTree;
 
 	public:
 		Path(const Path&) = default;
@@ -38,12 +41,14 @@ public:
 		~Path() = default;
 
 		void print(std::ostream& out) const;
+		size_t getMemoryUsage() const;
 
 	private:
 		static bool existsPathBetween(const DecoratedVertex& source, const DecoratedVertex& target);
 
 	private:
 		Path(const DecoratedVertex& source, const DecoratedVertex& target);
+		Path(std::forward_list<String>&& identifiers, const Distance& length);
 
 		void collectIdentifiersOnThePath(const DecoratedVertex& target);
 		void printIdentifiers(std::ostream& out) const;
@@ -60,6 +65,7 @@ public:
 
 	Path findShortestPath(const Graph& graph, const Vertex& source, const Vertex& target);
 	const String& getID() const;
+	virtual bool findsWeightedShortestPaths() const;
 
 protected:
 	static void initialiseSource(DecoratedVertex& source);
@@ -72,9 +78,7 @@ protected:
 	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) = 0;
 	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) = 0;
 	virtual void cleanUp() = 0;
-	virtual void addDecoratedVersionOf(const Vertex& vertex) = 0;
 	virtual DecoratedVertex& getDecoratedVersionOf(const Vertex& vertex) = 0;
-	void decorateVerticesOf(const Graph& graph);
 
 private:
 	Path createPathBetween(const Vertex& source, const Vertex& target);
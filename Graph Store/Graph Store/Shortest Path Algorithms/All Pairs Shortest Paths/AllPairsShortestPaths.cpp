@@ -0,0 +1,342 @@
+#include "AllPairsShortestPaths.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define HAS_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
+#if defined(HAS_AVX2_KERNEL) && defined(_MSC_VER)
+#include <intrin.h>
+#define AVX2_FUNCTION
+#elif defined(HAS_AVX2_KERNEL)
+#define AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+
+const std::uint32_t AllPairsShortestPaths::UNREACHABLE;
+const std::uint32_t AllPairsShortestPaths::NO_HOP;
+const size_t AllPairsShortestPaths::BLOCK_SIZE;
+const size_t AllPairsShortestPaths::ROW_PADDING;
+
+namespace
+{
+	typedef void (*RowRelaxation)(std::uint32_t* distances,
+								  std::uint32_t* nextHops,
+								  const std::uint32_t* distancesFromMiddle,
+								  std::uint32_t distanceToMiddle,
+								  std::uint32_t hopToMiddle,
+								  size_t count);
+
+	///
+	/// Improves distances[j] to distanceToMiddle + distancesFromMiddle[j]
+	/// where that is shorter, pointing nextHops[j] to the first hop towards
+	/// the middle vertex. A sum which overflows is unreachable.
+	///
+	void relaxRowScalar(std::uint32_t* distances,
+						std::uint32_t* nextHops,
+						const std::uint32_t* distancesFromMiddle,
+						std::uint32_t distanceToMiddle,
+						std::uint32_t hopToMiddle,
+						size_t count)
+	{
+		for (size_t j = 0; j < count; ++j)
+		{
+			std::uint32_t distanceThroughMiddle = distanceToMiddle + distancesFromMiddle[j];
+
+			if (distanceThroughMiddle >= distanceToMiddle && distanceThroughMiddle < distances[j])
+			{
+				distances[j] = distanceThroughMiddle;
+				nextHops[j] = hopToMiddle;
+			}
+		}
+	}
+
+#ifdef HAS_AVX2_KERNEL
+	///
+	/// The same as relaxRowScalar, eight distances at a time. count must be
+	/// a multiple of eight. AVX2 has no unsigned comparison, so a > b is
+	/// found as max(a, b) != b.
+	///
+	AVX2_FUNCTION
+	void relaxRowAVX2(std::uint32_t* distances,
+					  std::uint32_t* nextHops,
+					  const std::uint32_t* distancesFromMiddle,
+					  std::uint32_t distanceToMiddle,
+					  std::uint32_t hopToMiddle,
+					  size_t count)
+	{
+		const __m256i allOnes = _mm256_set1_epi32(-1);
+		const __m256i toMiddle = _mm256_set1_epi32(static_cast<int>(distanceToMiddle));
+		const __m256i hop = _mm256_set1_epi32(static_cast<int>(hopToMiddle));
+
+		for (size_t j = 0; j < count; j += 8)
+		{
+			__m256i* distancesPart = reinterpret_cast<__m256i*>(distances + j);
+			__m256i* nextHopsPart = reinterpret_cast<__m256i*>(nextHops + j);
+
+			__m256i throughMiddle = _mm256_add_epi32(toMiddle,
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(distancesFromMiddle + j)));
+			__m256i hasOverflowed = _mm256_xor_si256(
+				_mm256_cmpeq_epi32(_mm256_max_epu32(throughMiddle, toMiddle), throughMiddle), allOnes);
+			throughMiddle = _mm256_or_si256(throughMiddle, hasOverflowed);
+
+			__m256i current = _mm256_loadu_si256(distancesPart);
+			__m256i shortest = _mm256_min_epu32(current, throughMiddle);
+			__m256i isImproved = _mm256_xor_si256(_mm256_cmpeq_epi32(shortest, current), allOnes);
+
+			_mm256_storeu_si256(distancesPart, shortest);
+			_mm256_storeu_si256(nextHopsPart,
+				_mm256_blendv_epi8(_mm256_loadu_si256(nextHopsPart), hop, isImproved));
+		}
+	}
+
+	///
+	/// Besides the instructions themselves, the operating system has to
+	/// save the AVX registers, which XGETBV reports.
+	///
+	bool isAVX2Supported()
+	{
+#ifdef _MSC_VER
+		int registers[4];
+
+		__cpuid(registers, 1);
+		bool hasOSXSAVE = (registers[2] & (1 << 27)) != 0;
+		bool hasAVX = (registers[2] & (1 << 28)) != 0;
+
+		if (!(hasOSXSAVE && hasAVX) || (_xgetbv(0) & 0x6) != 0x6)
+		{
+			return false;
+		}
+
+		__cpuidex(registers, 7, 0);
+
+		return (registers[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}
+#endif
+
+	RowRelaxation selectRowRelaxation()
+	{
+#ifdef HAS_AVX2_KERNEL
+		if (isAVX2Supported())
+		{
+			return relaxRowAVX2;
+		}
+#endif
+		return relaxRowScalar;
+	}
+}
+
+///
+/// The matrices are padded to whole blocks with vertices without edges, so
+/// the kernels need no special case for the last block. The rows are a
+/// little longer still, so that the rows of a block do not all map to the
+/// same cache sets when the count is a power of two.
+///
+AllPairsShortestPaths::AllPairsShortestPaths(const Graph& graph) :
+	vertices(graph.getVerticesCount()),
+	paddedCount(roundUpToBlockSize(graph.getVerticesCount())),
+	rowLength(paddedCount + ROW_PADDING),
+	hasZeroWeightEdges(false)
+{
+	forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+	{
+		assert(v->getIndex() < vertices.size());
+
+		vertices[v->getIndex()] = v;
+	});
+
+	distances.assign(paddedCount * rowLength, UNREACHABLE);
+	nextHops.assign(paddedCount * rowLength, NO_HOP);
+
+	for (size_t i = 0; i < paddedCount; ++i)
+	{
+		distances[getPositionOf(i, i)] = 0;
+		nextHops[getPositionOf(i, i)] = static_cast<std::uint32_t>(i);
+	}
+
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		addEdges(concreteGraph);
+	});
+
+	runFloydWarshall();
+}
+
+size_t AllPairsShortestPaths::roundUpToBlockSize(size_t count)
+{
+	return (count + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE;
+}
+
+///
+/// Of several edges between the same two vertices only the lightest counts.
+///
+template <class ConcreteGraph>
+void AllPairsShortestPaths::addEdges(const ConcreteGraph& graph)
+{
+	for (const Vertex* start : vertices)
+	{
+		size_t startIndex = start->getIndex();
+
+		graph.forEachEdgeLeaving(*start, [&](const Edge& e)
+		{
+			size_t endIndex = e.getVertex().getIndex();
+			size_t position = getPositionOf(startIndex, endIndex);
+
+			if (e.getWeight() == 0)
+			{
+				hasZeroWeightEdges = true;
+			}
+
+			if (e.getWeight() < distances[position])
+			{
+				distances[position] = e.getWeight();
+				nextHops[position] = static_cast<std::uint32_t>(endIndex);
+			}
+		});
+	}
+}
+
+///
+/// Following the next hops, the distance to the target never grows, and it
+/// strictly decreases after an edge of positive weight. Along edges of zero
+/// weight the blocked order may leave next hops which go around in a circle,
+/// as a row of a block is relaxed through a vertex whose own distances are
+/// already relaxed through later vertices of the same block. The plain order
+/// does not, so a graph with such edges is run in it, row after row.
+///
+void AllPairsShortestPaths::runFloydWarshall()
+{
+	if (hasZeroWeightEdges)
+	{
+		runFloydWarshallInPlainOrder();
+	}
+	else
+	{
+		runFloydWarshallInBlocks();
+	}
+}
+
+void AllPairsShortestPaths::runFloydWarshallInPlainOrder()
+{
+	for (size_t middle = 0; middle < paddedCount; ++middle)
+	{
+		relaxRowsThrough(middle, 0, paddedCount, 0, paddedCount);
+	}
+}
+
+void AllPairsShortestPaths::runFloydWarshallInBlocks()
+{
+	size_t blocksCount = paddedCount / BLOCK_SIZE;
+
+	for (size_t middleBlock = 0; middleBlock < blocksCount; ++middleBlock)
+	{
+		relaxBlock(middleBlock, middleBlock, middleBlock);
+
+		for (size_t block = 0; block < blocksCount; ++block)
+		{
+			if (block != middleBlock)
+			{
+				relaxBlock(middleBlock, block, middleBlock);
+				relaxBlock(block, middleBlock, middleBlock);
+			}
+		}
+
+		for (size_t rowBlock = 0; rowBlock < blocksCount; ++rowBlock)
+		{
+			for (size_t columnBlock = 0; columnBlock < blocksCount; ++columnBlock)
+			{
+				if (rowBlock != middleBlock && columnBlock != middleBlock)
+				{
+					relaxBlock(rowBlock, columnBlock, middleBlock);
+				}
+			}
+		}
+	}
+}
+
+///
+/// Relaxes the paths between the vertices of the row block and those of
+/// the column block through each vertex of the middle block in turn.
+///
+void AllPairsShortestPaths::relaxBlock(size_t rowBlock, size_t columnBlock, size_t middleBlock)
+{
+	size_t firstMiddle = middleBlock * BLOCK_SIZE;
+
+	for (size_t middle = firstMiddle; middle < firstMiddle + BLOCK_SIZE; ++middle)
+	{
+		relaxRowsThrough(middle, rowBlock * BLOCK_SIZE, BLOCK_SIZE, columnBlock * BLOCK_SIZE, BLOCK_SIZE);
+	}
+}
+
+void AllPairsShortestPaths::relaxRowsThrough(size_t middle,
+											 size_t firstRow,
+											 size_t rowsCount,
+											 size_t firstColumn,
+											 size_t columnsCount)
+{
+	static const RowRelaxation relaxRow = selectRowRelaxation();
+
+	const std::uint32_t* distancesFromMiddle = &distances[getPositionOf(middle, firstColumn)];
+
+	for (size_t row = firstRow; row < firstRow + rowsCount; ++row)
+	{
+		size_t toMiddle = getPositionOf(row, middle);
+
+		if (distances[toMiddle] != UNREACHABLE)
+		{
+			size_t rowStart = getPositionOf(row, firstColumn);
+
+			relaxRow(&distances[rowStart],
+					 &nextHops[rowStart],
+					 distancesFromMiddle,
+					 distances[toMiddle],
+					 nextHops[toMiddle],
+					 columnsCount);
+		}
+	}
+}
+
+size_t AllPairsShortestPaths::getPositionOf(size_t sourceIndex, size_t targetIndex) const
+{
+	return sourceIndex * rowLength + targetIndex;
+}
+
+Distance AllPairsShortestPaths::getDistanceBetween(const Vertex& source, const Vertex& target) const
+{
+	assert(source.getIndex() < vertices.size() && target.getIndex() < vertices.size());
+
+	std::uint32_t distance = distances[getPositionOf(source.getIndex(), target.getIndex())];
+
+	return (distance != UNREACHABLE) ? Distance(distance) : Distance::getInfinity();
+}
+
+ShortestPathAlgorithm::Path
+AllPairsShortestPaths::getPathBetween(const Vertex& source, const Vertex& target) const
+{
+	std::forward_list<String> identifiers;
+	size_t targetIndex = target.getIndex();
+
+	if (nextHops[getPositionOf(source.getIndex(), targetIndex)] != NO_HOP)
+	{
+		std::forward_list<String>::iterator last = identifiers.before_begin();
+
+		for (size_t index = source.getIndex(); index != targetIndex; index = nextHops[getPositionOf(index, targetIndex)])
+		{
+			last = identifiers.insert_after(last, vertices[index]->getID());
+		}
+
+		identifiers.insert_after(last, target.getID());
+	}
+
+	return ShortestPathAlgorithm::Path(std::move(identifiers), getDistanceBetween(source, target));
+}
+
+size_t AllPairsShortestPaths::getVerticesCount() const
+{
+	return vertices.size();
+}
\ No newline at end of file
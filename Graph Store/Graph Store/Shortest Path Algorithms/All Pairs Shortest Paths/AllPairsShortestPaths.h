@@ -0,0 +1,71 @@
+#ifndef __ALL_PAIRS_SHORTEST_PATHS_HEADER_INCLUDED__
+#define __ALL_PAIRS_SHORTEST_PATHS_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include <cstdint>
+#include <vector>
+
+///
+/// The distance between every two vertices of a graph together with the
+/// next vertex on a shortest path between them, in dense matrices indexed
+/// by vertex index. Meant for small graphs: both matrices take quadratic
+/// space, but a query afterwards is a lookup plus walking the path.
+///
+/// The matrices are computed by Floyd-Warshall in square blocks (Venkataraman
+/// et al.): for each block on the diagonal, the diagonal block is relaxed
+/// through itself, then the blocks in its row and column through it, and
+/// then all other blocks through the ones in that row and column. Each block
+/// stays in cache while it is used. The rows of a block are relaxed with AVX2
+/// where the processor supports it, eight distances at a time. A graph with
+/// edges of zero weight is run in the plain order instead (see
+/// runFloydWarshall).
+///
+class AllPairsShortestPaths
+{
+	typedef std::vector<std::uint32_t> Matrix;
+	typedef std::vector<const Vertex*> VerticesArray;
+
+public:
+	explicit AllPairsShortestPaths(const Graph& graph);
+	AllPairsShortestPaths(const AllPairsShortestPaths&) = delete;
+	AllPairsShortestPaths& operator=(const AllPairsShortestPaths&) = delete;
+	~AllPairsShortestPaths() = default;
+
+	Distance getDistanceBetween(const Vertex& source, const Vertex& target) const;
+	ShortestPathAlgorithm::Path getPathBetween(const Vertex& source, const Vertex& target) const;
+	size_t getVerticesCount() const;
+
+private:
+	static const std::uint32_t UNREACHABLE = static_cast<std::uint32_t>(-1);
+	static const std::uint32_t NO_HOP = static_cast<std::uint32_t>(-1);
+	static const size_t BLOCK_SIZE = 64;
+	static const size_t ROW_PADDING = 16;
+
+private:
+	static size_t roundUpToBlockSize(size_t count);
+
+private:
+	template <class ConcreteGraph>
+	void addEdges(const ConcreteGraph& graph);
+
+	void runFloydWarshall();
+	void runFloydWarshallInPlainOrder();
+	void runFloydWarshallInBlocks();
+	void relaxBlock(size_t rowBlock, size_t columnBlock, size_t middleBlock);
+	void relaxRowsThrough(size_t middle,
+						  size_t firstRow,
+						  size_t rowsCount,
+						  size_t firstColumn,
+						  size_t columnsCount);
+	size_t getPositionOf(size_t sourceIndex, size_t targetIndex) const;
+
+private:
+	VerticesArray vertices;
+	size_t paddedCount;
+	size_t rowLength;
+	Matrix distances;
+	Matrix nextHops;
+	bool hasZeroWeightEdges;
+};
+
+#endif //__ALL_PAIRS_SHORTEST_PATHS_HEADER_INCLUDED__
\ No newline at end of file
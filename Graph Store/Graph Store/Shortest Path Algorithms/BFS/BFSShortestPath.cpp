@@ -1,112 +1,477 @@
 #include "BFSShortestPath.h"
 #include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
-#include "../../Graph/Abstract class/Graph.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include <algorithm>
+#include <bitset>
 #include <assert.h>
 
 static ShortestPathAlgorithmRegistrator<BFSShortestPath> registrator("bfs");
 
+const std::uint32_t BFSShortestPath::NO_PARENT;
+
 BFSShortestPath::BFSShortestPath(const String& id) :
-	SearchBasedShortestPathAlgorithm(id)
+	ShortestPathAlgorithm(id),
+	threadsCount(ThreadPool::getDefaultThreadsCount()),
+	bitmapsCapacity(0),
+	wordsCount(0),
+	verticesCount(0),
+	visitedCount(0),
+	frontierSize(0),
+	isBottomUp(false),
+	hasAllVertices(false)
 {
 }
 
-void BFSShortestPath::initialise(const Graph& graph,
-								 const Vertex& source,
-								 const Vertex& target)
+///
+/// 0 stands for the number of hardware threads.
+///
+void BFSShortestPath::setThreadsCount(size_t threadsCount)
+{
+	this->threadsCount = (threadsCount > 0) ? threadsCount : ThreadPool::getDefaultThreadsCount();
+}
+
+size_t BFSShortestPath::getThreadsCount() const
 {
-	assert(frontier.isEmpty());
+	return threadsCount;
+}
+
+///
+/// The search counts the edges of a path and ignores their weights.
+///
+bool BFSShortestPath::findsWeightedShortestPaths() const
+{
+	return false;
+}
 
-	if (source != target)
+///
+/// The threads are only started by the first level large enough to be
+/// expanded in parallel, and again when their number changes.
+///
+ThreadPool& BFSShortestPath::getThreadPool()
+{
+	if (threadPool == nullptr || threadPool->getThreadsCount() != threadsCount)
 	{
-		foundAShortestPath = false;
-		setTarget(target);
-		decorateVerticesOf(graph);
-		initialiseSourceAndAddItToFrontier(source);
+		threadPool.reset();
+		threadPool.reset(new ThreadPool(threadsCount));
 	}
-	else
+
+	return *threadPool;
+}
+
+void BFSShortestPath::initialise(const Graph& graph,
+								 const Vertex& source,
+								 const Vertex&)
+{
+	verticesCount = graph.getVerticesCount();
+
+	decoratedVertices.startNewSession(verticesCount);
+	initialiseSource(decoratedVertices[source]);
+
+	prepareBitmaps(verticesCount);
+
+	if (verticesByIndex.size() < verticesCount)
 	{
-		foundAShortestPath = true;
-		prepareTrivialPath(source);
+		verticesByIndex.resize(verticesCount);
+		parents.resize(verticesCount);
 	}
+
+	nextFrontiersOfThreads.resize(threadsCount);
+	isBottomUp = false;
+	hasAllVertices = false;
+
+	tryToVisit(source, NO_PARENT);
+	frontier.push_back(&source);
+	frontierSize = 1;
+	visitedCount = 1;
 }
 
-void BFSShortestPath::initialiseSourceAndAddItToFrontier(const Vertex& source)
+///
+/// Only the visited bitmap has to be cleared for every search. The frontier
+/// bitmaps are cleared when the search turns bottom-up.
+///
+void BFSShortestPath::prepareBitmaps(size_t verticesCount)
 {
-	MarkableDecoratedVertex& decoratedSource = getDecoratedVersionOf(source);
+	wordsCount = (verticesCount + BITS_PER_WORD - 1) / BITS_PER_WORD;
 
-	decoratedSource.isVisited = true;
-	initialiseSource(decoratedSource);
-	addToFrontier(decoratedSource);
+	if (bitmapsCapacity < wordsCount)
+	{
+		visited.reset(new BitmapWord[wordsCount]);
+		frontierBitmap.reset(new BitmapWord[wordsCount]);
+		nextFrontierBitmap.reset(new BitmapWord[wordsCount]);
+		bitmapsCapacity = wordsCount;
+	}
+
+	clearBitmap(visited, wordsCount);
 }
 
-void BFSShortestPath::addToFrontier(const MarkableDecoratedVertex& v)
+void BFSShortestPath::clearBitmap(Bitmap& bitmap, size_t wordsCount)
 {
-	frontier.enqueue(&v);
+	for (size_t i = 0; i < wordsCount; ++i)
+	{
+		bitmap[i].store(0, std::memory_order_relaxed);
+	}
 }
 
-void BFSShortestPath::prepareTrivialPath(const Vertex& source)
+BFSShortestPath::DecoratedVertex& BFSShortestPath::getDecoratedVersionOf(const Vertex& v)
 {
-	addDecoratedVersionOf(source);
-	initialiseSource(getDecoratedVersionOf(source));
+	return decoratedVertices[v];
 }
 
 void BFSShortestPath::execute(const Graph& graph,
-							  const Vertex& source,
+							  const Vertex&,
 							  const Vertex& target)
 {
-	const MarkableDecoratedVertex* vertex;
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		searchIn(concreteGraph, graph, target);
+	});
+
+	collectPathTo(target);
+}
+
+template <class ConcreteGraph>
+void BFSShortestPath::searchIn(const ConcreteGraph& concreteGraph,
+							   const Graph& graph,
+							   const Vertex& target)
+{
+	while (frontierSize > 0 && !isVisited(target.getIndex()))
+	{
+		chooseDirection(graph);
+
+		if (isBottomUp)
+		{
+			expandBottomUp(concreteGraph);
+		}
+		else
+		{
+			expandTopDown(concreteGraph);
+		}
+	}
+}
 
-	while (!(foundAShortestPath || frontier.isEmpty()))
+void BFSShortestPath::chooseDirection(const Graph& graph)
+{
+	if (shouldSwitchToBottomUp())
 	{
-		vertex = extractNextVertexFromFrontier();
-		exploreEdgesLeaving(*vertex, graph);
+		collectAllVerticesOf(graph);
+		moveFrontierToBitmap();
+		isBottomUp = true;
 	}
+	else if (shouldSwitchToTopDown())
+	{
+		moveFrontierToArray();
+		isBottomUp = false;
+	}
+}
+
+bool BFSShortestPath::shouldSwitchToBottomUp() const
+{
+	return !isBottomUp && frontierSize * ALPHA > verticesCount - visitedCount;
 }
 
-void BFSShortestPath::exploreEdgesLeaving(const MarkableDecoratedVertex& predecessor,
-										  const Graph& graph)
+bool BFSShortestPath::shouldSwitchToTopDown() const
 {
-	Graph::EdgesConstIterator iterator =
-		graph.getConstIteratorOfEdgesLeaving(predecessor.originalVertex);
+	return isBottomUp && frontierSize * BETA < verticesCount;
+}
 
-	forEach(*iterator, [&](const Edge& e)
+///
+/// A bottom-up level scans every unvisited vertex, so the vertices which
+/// the search has not reached are looked up once, when it first turns
+/// bottom-up.
+///
+void BFSShortestPath::collectAllVerticesOf(const Graph& graph)
+{
+	if (hasAllVertices)
 	{
-		MarkableDecoratedVertex& successor = getDecoratedVersionOf(e.getVertex());
+		return;
+	}
+
+	forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+	{
+		assert(v->getIndex() < verticesCount);
 
-		exploreEdge(predecessor, successor);
+		verticesByIndex[v->getIndex()] = v;
 	});
+
+	hasAllVertices = true;
 }
 
-void BFSShortestPath::exploreEdge(const MarkableDecoratedVertex& predecessor,
-								  MarkableDecoratedVertex& successor)
+void BFSShortestPath::moveFrontierToBitmap()
 {
-	if (successor.isVisited)
+	clearBitmap(frontierBitmap, wordsCount);
+
+	for (const Vertex* v : frontier)
 	{
-		return;
+		size_t index = v->getIndex();
+		BitmapWord& word = frontierBitmap[getWordIndexOf(index)];
+
+		word.store(word.load(std::memory_order_relaxed) | getBitOf(index), std::memory_order_relaxed);
 	}
 
-	visitVertex(successor, predecessor);
-	addToFrontier(successor);
-	checkIfTarget(successor);
+	frontier.clear();
 }
 
-void BFSShortestPath::visitVertex(MarkableDecoratedVertex& successor,
-								  const MarkableDecoratedVertex& predecessor)
+void BFSShortestPath::moveFrontierToArray()
 {
-	assert(!successor.isVisited);
-	successor.isVisited = true;
+	frontier.clear();
+
+	for (size_t i = 0; i < wordsCount; ++i)
+	{
+		std::uint64_t word = frontierBitmap[i].load(std::memory_order_relaxed);
 
-	SearchBasedShortestPathAlgorithm::visitVertex(successor, predecessor);
+		for (size_t index = i * BITS_PER_WORD; word != 0; ++index, word >>= 1)
+		{
+			if (word & 1)
+			{
+				frontier.push_back(verticesByIndex[index]);
+			}
+		}
+	}
+
+	assert(frontier.size() == frontierSize);
+}
+
+///
+/// Small levels are not worth waking the threads for, so they are expanded
+/// by the calling thread alone.
+///
+template <class ConcreteGraph>
+void BFSShortestPath::expandTopDown(const ConcreteGraph& graph)
+{
+	if (frontier.size() < MIN_PARALLEL_LEVEL_SIZE)
+	{
+		for (const Vertex* v : frontier)
+		{
+			exploreEdgesLeaving(*v, graph, nextFrontiersOfThreads[0]);
+		}
+	}
+	else
+	{
+		std::atomic<size_t> nextChunk(0);
+
+		getThreadPool().runOnEveryThread([&](size_t threadIndex)
+		{
+			VerticesArray& next = nextFrontiersOfThreads[threadIndex];
+
+			for (size_t first = nextChunk.fetch_add(VERTICES_PER_CHUNK);
+				 first < frontier.size();
+				 first = nextChunk.fetch_add(VERTICES_PER_CHUNK))
+			{
+				size_t last = std::min(first + VERTICES_PER_CHUNK, frontier.size());
+
+				for (size_t i = first; i < last; ++i)
+				{
+					exploreEdgesLeaving(*frontier[i], graph, next);
+				}
+			}
+		});
+	}
+
+	mergeNextFrontiers();
 }
 
-const BFSShortestPath::MarkableDecoratedVertex*
-BFSShortestPath::extractNextVertexFromFrontier()
+template <class ConcreteGraph>
+void BFSShortestPath::exploreEdgesLeaving(const Vertex& v,
+										  const ConcreteGraph& graph,
+										  VerticesArray& next)
 {
-	return frontier.dequeue();
+	size_t parentIndex = v.getIndex();
+
+	graph.forEachEdgeLeaving(v, [&](const Edge& e)
+	{
+		if (tryToVisit(e.getVertex(), parentIndex))
+		{
+			next.push_back(&e.getVertex());
+		}
+	});
 }
 
-void BFSShortestPath::cleanUp()
+///
+/// Sets the visited bit of v atomically, so only one thread visits it and
+/// records its parent. The plain load first keeps the threads from
+/// writing to the words of the vertices which are visited already.
+///
+bool BFSShortestPath::tryToVisit(const Vertex& v, size_t parentIndex)
 {
-	frontier.empty();
-	SearchBasedShortestPathAlgorithm::cleanUp();
+	size_t index = v.getIndex();
+	BitmapWord& word = visited[getWordIndexOf(index)];
+	std::uint64_t bit = getBitOf(index);
+
+	if ((word.load(std::memory_order_relaxed) & bit) != 0
+		|| (word.fetch_or(bit, std::memory_order_relaxed) & bit) != 0)
+	{
+		return false;
+	}
+
+	parents[index] = static_cast<std::uint32_t>(parentIndex);
+	verticesByIndex[index] = &v;
+
+	return true;
+}
+
+void BFSShortestPath::mergeNextFrontiers()
+{
+	frontier.clear();
+
+	for (VerticesArray& next : nextFrontiersOfThreads)
+	{
+		frontier.insert(frontier.end(), next.begin(), next.end());
+		next.clear();
+	}
+
+	frontierSize = frontier.size();
+	visitedCount += frontierSize;
+}
+
+///
+/// The threads take the words of the bitmaps in chunks, so every word of
+/// the visited and the next frontier bitmaps is written by one thread only.
+/// A level with few unvisited vertices is expanded by the calling thread.
+///
+template <class ConcreteGraph>
+void BFSShortestPath::expandBottomUp(const ConcreteGraph& graph)
+{
+	std::atomic<size_t> nextChunk(0);
+	std::atomic<size_t> foundCount(0);
+
+	auto expandChunks = [&](size_t)
+	{
+		size_t foundByThread = 0;
+
+		for (size_t first = nextChunk.fetch_add(WORDS_PER_CHUNK);
+			 first < wordsCount;
+			 first = nextChunk.fetch_add(WORDS_PER_CHUNK))
+		{
+			size_t last = std::min(first + WORDS_PER_CHUNK, wordsCount);
+
+			for (size_t i = first; i < last; ++i)
+			{
+				std::uint64_t found = findParentsOfVerticesInWord(i, graph);
+
+				nextFrontierBitmap[i].store(found, std::memory_order_relaxed);
+				foundByThread += std::bitset<BITS_PER_WORD>(found).count();
+			}
+		}
+
+		foundCount.fetch_add(foundByThread, std::memory_order_relaxed);
+	};
+
+	if (verticesCount - visitedCount < MIN_PARALLEL_LEVEL_SIZE)
+	{
+		expandChunks(0);
+	}
+	else
+	{
+		getThreadPool().runOnEveryThread(expandChunks);
+	}
+
+	std::swap(frontierBitmap, nextFrontierBitmap);
+	frontierSize = foundCount.load(std::memory_order_relaxed);
+	visitedCount += frontierSize;
+}
+
+///
+/// Looks for a parent in the frontier for every unvisited vertex whose bit
+/// is in the word and returns the bits of the vertices which found one.
+/// The edges are scanned through forEachEdgeEntering, which can not stop,
+/// so the rest of them are only skipped once a parent is found.
+///
+template <class ConcreteGraph>
+std::uint64_t BFSShortestPath::findParentsOfVerticesInWord(size_t wordIndex,
+														   const ConcreteGraph& graph)
+{
+	std::uint64_t visitedWord = visited[wordIndex].load(std::memory_order_relaxed);
+	std::uint64_t found = 0;
+	size_t first = wordIndex * BITS_PER_WORD;
+	size_t last = std::min(first + BITS_PER_WORD, verticesCount);
+
+	for (size_t index = first; index < last; ++index)
+	{
+		std::uint64_t bit = getBitOf(index);
+
+		if ((visitedWord & bit) != 0)
+		{
+			continue;
+		}
+
+		graph.forEachEdgeEntering(*verticesByIndex[index], [&](const Edge& e)
+		{
+			size_t parentIndex = e.getVertex().getIndex();
+
+			if ((found & bit) == 0 && isInFrontier(parentIndex))
+			{
+				parents[index] = static_cast<std::uint32_t>(parentIndex);
+				found |= bit;
+			}
+		});
+	}
+
+	if (found != 0)
+	{
+		visited[wordIndex].store(visitedWord | found, std::memory_order_relaxed);
+	}
+
+	return found;
+}
+
+bool BFSShortestPath::isVisited(size_t vertexIndex) const
+{
+	return (visited[getWordIndexOf(vertexIndex)].load(std::memory_order_relaxed) & getBitOf(vertexIndex)) != 0;
+}
+
+bool BFSShortestPath::isInFrontier(size_t vertexIndex) const
+{
+	return (frontierBitmap[getWordIndexOf(vertexIndex)].load(std::memory_order_relaxed) & getBitOf(vertexIndex)) != 0;
 }
+
+size_t BFSShortestPath::getWordIndexOf(size_t vertexIndex)
+{
+	return vertexIndex / BITS_PER_WORD;
+}
+
+std::uint64_t BFSShortestPath::getBitOf(size_t vertexIndex)
+{
+	return static_cast<std::uint64_t>(1) << (vertexIndex % BITS_PER_WORD);
+}
+
+///
+/// Turns the parent indices on the path to the target into decorated
+/// vertices, so the path is collected as for the other algorithms. The
+/// length of the path is the number of its edges.
+///
+void BFSShortestPath::collectPathTo(const Vertex& target)
+{
+	if (!isVisited(target.getIndex()))
+	{
+		return;
+	}
+
+	unsigned length = 0;
+
+	for (size_t index = target.getIndex(); parents[index] != NO_PARENT; index = parents[index])
+	{
+		++length;
+	}
+
+	DecoratedVertex* current = &getDecoratedVersionOf(target);
+	current->distanceToSource = length;
+
+	for (size_t index = target.getIndex(); parents[index] != NO_PARENT; index = parents[index])
+	{
+		DecoratedVertex& parent = getDecoratedVersionOf(*verticesByIndex[parents[index]]);
+
+		parent.distanceToSource = --length;
+		current->parent = &parent;
+		current = &parent;
+	}
+}
+
+void BFSShortestPath::cleanUp()
+{
+	frontier.clear();
+
+	for (VerticesArray& next : nextFrontiersOfThreads)
+	{
+		next.clear();
+	}
+}
\ No newline at end of file
@@ -1,31 +1,115 @@
 #ifndef __BFS_SHORTEST_PATH_HEADER_INCLUDED__
 #define __BFS_SHORTEST_PATH_HEADER_INCLUDED__
 
-#include "../Search Based Shortest Path Algorithm/SearchBasedShortestPathAlgorithm.h"
-#include "../../Queue/Queue.h"
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../Decorated Vertices/DecoratedVertices.h"
+#include "../../Thread Pool/ThreadPool.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
-class BFSShortestPath : public SearchBasedShortestPathAlgorithm
+///
+/// Direction-optimising breadth-first search (Beamer, Asanovic and
+/// Patterson). A level is expanded either top-down, from the frontier over
+/// the edges leaving it, or bottom-up, from every unvisited vertex over the
+/// edges entering it until one comes from the frontier. Bottom-up pays off
+/// once the frontier holds a large part of the graph, which happens within
+/// a few levels on low-diameter graphs: most edges then lead to visited
+/// vertices anyway.
+///
+/// The search switches to bottom-up when the frontier outgrows the
+/// unvisited vertices divided by ALPHA and back to top-down when it shrinks
+/// below all the vertices divided by BETA. The edge counts of the original
+/// heuristic are estimated by vertex counts.
+///
+/// The visited vertices and the frontier of a bottom-up level are dense
+/// bitmaps indexed by vertex index, and the frontier of a top-down level is
+/// an array. Large levels are expanded in parallel: top-down, the threads
+/// claim a vertex by setting its visited bit atomically; bottom-up, each
+/// thread owns whole words of the bitmaps.
+///
+class BFSShortestPath : public ShortestPathAlgorithm
 {
+	typedef std::vector<const Vertex*> VerticesArray;
+	typedef std::atomic<std::uint64_t> BitmapWord;
+	typedef std::unique_ptr<BitmapWord[]> Bitmap;
+
 public:
 	explicit BFSShortestPath(const String& id);
 	BFSShortestPath(const BFSShortestPath&) = delete;
 	BFSShortestPath& operator=(const BFSShortestPath&) = delete;
 
+	void setThreadsCount(size_t threadsCount);
+	size_t getThreadsCount() const;
+	virtual bool findsWeightedShortestPaths() const override;
+
+private:
+	static const size_t ALPHA = 14;
+	static const size_t BETA = 24;
+	static const size_t BITS_PER_WORD = 64;
+	static const size_t WORDS_PER_CHUNK = 16;
+	static const size_t VERTICES_PER_CHUNK = 256;
+	static const size_t MIN_PARALLEL_LEVEL_SIZE = 1024;
+	static const std::uint32_t NO_PARENT = static_cast<std::uint32_t>(-1);
+
+private:
+	static size_t getWordIndexOf(size_t vertexIndex);
+	static std::uint64_t getBitOf(size_t vertexIndex);
+	static void clearBitmap(Bitmap& bitmap, size_t wordsCount);
+
 private:
 	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
 	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
 	virtual void cleanUp() override;
-	virtual void visitVertex(MarkableDecoratedVertex& successor,
-							 const MarkableDecoratedVertex& predecessor) override;
-	void initialiseSourceAndAddItToFrontier(const Vertex& source);
-	void addToFrontier(const MarkableDecoratedVertex& v);
-	void prepareTrivialPath(const Vertex& source);
-	const MarkableDecoratedVertex* extractNextVertexFromFrontier();
-	void exploreEdgesLeaving(const MarkableDecoratedVertex& predecessor, const Graph& graph);
-	void exploreEdge(const MarkableDecoratedVertex& predecessor, MarkableDecoratedVertex& successor);
+	virtual DecoratedVertex& getDecoratedVersionOf(const Vertex& vertex) override;
+	void prepareBitmaps(size_t verticesCount);
+	void chooseDirection(const Graph& graph);
+	bool shouldSwitchToBottomUp() const;
+	bool shouldSwitchToTopDown() const;
+	void collectAllVerticesOf(const Graph& graph);
+	void moveFrontierToBitmap();
+	void moveFrontierToArray();
+	void mergeNextFrontiers();
+	bool tryToVisit(const Vertex& v, size_t parentIndex);
+	bool isVisited(size_t vertexIndex) const;
+	bool isInFrontier(size_t vertexIndex) const;
+	void collectPathTo(const Vertex& target);
+	ThreadPool& getThreadPool();
+
+	template <class ConcreteGraph>
+	void searchIn(const ConcreteGraph& concreteGraph, const Graph& graph, const Vertex& target);
+
+	template <class ConcreteGraph>
+	void expandTopDown(const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void expandBottomUp(const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void exploreEdgesLeaving(const Vertex& v, const ConcreteGraph& graph, VerticesArray& next);
+
+	template <class ConcreteGraph>
+	std::uint64_t findParentsOfVerticesInWord(size_t wordIndex, const ConcreteGraph& graph);
 
 private:
-	Queue<const MarkableDecoratedVertex*> frontier;
+	size_t threadsCount;
+	std::unique_ptr<ThreadPool> threadPool;
+	Bitmap visited;
+	Bitmap frontierBitmap;
+	Bitmap nextFrontierBitmap;
+	size_t bitmapsCapacity;
+	size_t wordsCount;
+	size_t verticesCount;
+	size_t visitedCount;
+	size_t frontierSize;
+	bool isBottomUp;
+	bool hasAllVertices;
+	std::vector<std::uint32_t> parents;
+	VerticesArray verticesByIndex;
+	VerticesArray frontier;
+	std::vector<VerticesArray> nextFrontiersOfThreads;
+	DecoratedVertices<DecoratedVertex> decoratedVertices;
 };
 
 #endif //__BFS_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
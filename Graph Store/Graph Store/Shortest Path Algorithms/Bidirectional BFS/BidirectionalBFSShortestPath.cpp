@@ -0,0 +1,191 @@
+#include "BidirectionalBFSShortestPath.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
+
+static ShortestPathAlgorithmRegistrator<BidirectionalBFSShortestPath> registrator("bfs-bidir");
+
+BidirectionalBFSShortestPath::BidirectionalBFSShortestPath(const String& id) :
+	ShortestPathAlgorithm(id),
+	meetingVertex(nullptr),
+	shortestPathLength(0)
+{
+}
+
+///
+/// The search counts the edges of a path and ignores their weights.
+///
+bool BidirectionalBFSShortestPath::findsWeightedShortestPaths() const
+{
+	return false;
+}
+
+void BidirectionalBFSShortestPath::initialise(const Graph& graph,
+											  const Vertex& source,
+											  const Vertex& target)
+{
+	decoratedVertices.startNewSession(graph.getVerticesCount());
+
+	meetingVertex = nullptr;
+
+	BidirectionalVertex& decoratedSource = getDecoratedVersionOf(source);
+	initialiseSource(decoratedSource);
+	reachFromSource(decoratedSource, nullptr, 0);
+	frontierFromSource.push_back(&decoratedSource);
+
+	BidirectionalVertex& decoratedTarget = getDecoratedVersionOf(target);
+	reachFromTarget(decoratedTarget, nullptr, 0);
+	frontierFromTarget.push_back(&decoratedTarget);
+}
+
+BidirectionalBFSShortestPath::BidirectionalVertex&
+BidirectionalBFSShortestPath::getDecoratedVersionOf(const Vertex& v)
+{
+	return decoratedVertices[v];
+}
+
+void BidirectionalBFSShortestPath::execute(const Graph& graph,
+										   const Vertex& source,
+										   const Vertex& target)
+{
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		searchIn(concreteGraph);
+	});
+
+	if (meetingVertex != nullptr)
+	{
+		joinPathsAt(*meetingVertex, target);
+	}
+}
+
+///
+/// Once either frontier is empty, every vertex connected to its end has
+/// been reached without meeting the other search, so there is no path.
+///
+template <class ConcreteGraph>
+void BidirectionalBFSShortestPath::searchIn(const ConcreteGraph& graph)
+{
+	while (meetingVertex == nullptr
+		   && !frontierFromSource.empty()
+		   && !frontierFromTarget.empty())
+	{
+		if (frontierFromSource.size() <= frontierFromTarget.size())
+		{
+			advanceSearchFromSource(graph);
+		}
+		else
+		{
+			advanceSearchFromTarget(graph);
+		}
+	}
+}
+
+template <class ConcreteGraph>
+void BidirectionalBFSShortestPath::advanceSearchFromSource(const ConcreteGraph& graph)
+{
+	for (BidirectionalVertex* start : frontierFromSource)
+	{
+		unsigned level = start->levelFromSource + 1;
+
+		graph.forEachEdgeLeaving(*start->originalVertex, [&](const Edge& e)
+		{
+			BidirectionalVertex& end = getDecoratedVersionOf(e.getVertex());
+
+			if (!end.isReachedFromSource)
+			{
+				reachFromSource(end, start, level);
+				nextFrontier.push_back(&end);
+			}
+		});
+	}
+
+	frontierFromSource.swap(nextFrontier);
+	nextFrontier.clear();
+}
+
+template <class ConcreteGraph>
+void BidirectionalBFSShortestPath::advanceSearchFromTarget(const ConcreteGraph& graph)
+{
+	for (BidirectionalVertex* end : frontierFromTarget)
+	{
+		unsigned level = end->levelFromTarget + 1;
+
+		graph.forEachEdgeEntering(*end->originalVertex, [&](const Edge& e)
+		{
+			BidirectionalVertex& start = getDecoratedVersionOf(e.getVertex());
+
+			if (!start.isReachedFromTarget)
+			{
+				reachFromTarget(start, end, level);
+				nextFrontier.push_back(&start);
+			}
+		});
+	}
+
+	frontierFromTarget.swap(nextFrontier);
+	nextFrontier.clear();
+}
+
+void BidirectionalBFSShortestPath::reachFromSource(BidirectionalVertex& v,
+												   BidirectionalVertex* parent,
+												   unsigned level)
+{
+	v.isReachedFromSource = true;
+	v.levelFromSource = level;
+	v.parent = parent;
+
+	updateShortestPathThrough(v);
+}
+
+void BidirectionalBFSShortestPath::reachFromTarget(BidirectionalVertex& v,
+												   BidirectionalVertex* successor,
+												   unsigned level)
+{
+	v.isReachedFromTarget = true;
+	v.levelFromTarget = level;
+	v.successor = successor;
+
+	updateShortestPathThrough(v);
+}
+
+void BidirectionalBFSShortestPath::updateShortestPathThrough(BidirectionalVertex& v)
+{
+	if (!(v.isReachedFromSource && v.isReachedFromTarget))
+	{
+		return;
+	}
+
+	unsigned lengthOfPathThroughV = v.levelFromSource + v.levelFromTarget;
+
+	if (meetingVertex == nullptr || lengthOfPathThroughV < shortestPathLength)
+	{
+		shortestPathLength = lengthOfPathThroughV;
+		meetingVertex = &v;
+	}
+}
+
+///
+/// Turns the path from the meeting vertex to the target into parent links,
+/// so the path is collected as if it was found by a search from the source.
+/// The halves of a shortest path share no vertex but the meeting one.
+///
+void BidirectionalBFSShortestPath::joinPathsAt(BidirectionalVertex& v,
+											   const Vertex& target)
+{
+	BidirectionalVertex* current = &v;
+
+	while (current->successor != nullptr)
+	{
+		current->successor->parent = current;
+		current = current->successor;
+	}
+
+	getDecoratedVersionOf(target).distanceToSource = shortestPathLength;
+}
+
+void BidirectionalBFSShortestPath::cleanUp()
+{
+	frontierFromSource.clear();
+	frontierFromTarget.clear();
+	nextFrontier.clear();
+}
\ No newline at end of file
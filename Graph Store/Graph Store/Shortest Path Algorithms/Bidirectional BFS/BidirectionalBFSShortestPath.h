@@ -0,0 +1,76 @@
+#ifndef __BIDIRECTIONAL_BFS_SHORTEST_PATH_HEADER_INCLUDED__
+#define __BIDIRECTIONAL_BFS_SHORTEST_PATH_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../Decorated Vertices/DecoratedVertices.h"
+#include <vector>
+
+///
+/// Runs breadth-first search forward from the source and backward from the
+/// target, over the edges entering each vertex, a whole level at a time and
+/// always from the smaller frontier. On small-world graphs the two searches
+/// meet after touching a small part of the graph each.
+///
+/// The first level which reaches a vertex already reached by the other
+/// search yields the shortest path: every vertex it reaches from the other
+/// side is a meeting point and the one with the shortest path through it
+/// is taken.
+///
+class BidirectionalBFSShortestPath : public ShortestPathAlgorithm
+{
+	struct BidirectionalVertex : public DecoratedVertex
+	{
+		BidirectionalVertex(const Vertex* originalVertex = nullptr) :
+			DecoratedVertex(originalVertex),
+			successor(nullptr),
+			levelFromSource(0),
+			levelFromTarget(0),
+			isReachedFromSource(false),
+			isReachedFromTarget(false)
+		{
+		}
+
+		BidirectionalVertex* successor;
+		unsigned levelFromSource;
+		unsigned levelFromTarget;
+		bool isReachedFromSource;
+		bool isReachedFromTarget;
+	};
+
+	typedef std::vector<BidirectionalVertex*> Frontier;
+
+public:
+	explicit BidirectionalBFSShortestPath(const String& id);
+	BidirectionalBFSShortestPath(const BidirectionalBFSShortestPath&) = delete;
+	BidirectionalBFSShortestPath& operator=(const BidirectionalBFSShortestPath&) = delete;
+	virtual bool findsWeightedShortestPaths() const override;
+
+private:
+	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void cleanUp() override;
+	virtual BidirectionalVertex& getDecoratedVersionOf(const Vertex& vertex) override;
+	void reachFromSource(BidirectionalVertex& v, BidirectionalVertex* parent, unsigned level);
+	void reachFromTarget(BidirectionalVertex& v, BidirectionalVertex* successor, unsigned level);
+	void updateShortestPathThrough(BidirectionalVertex& v);
+	void joinPathsAt(BidirectionalVertex& v, const Vertex& target);
+
+	template <class ConcreteGraph>
+	void searchIn(const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void advanceSearchFromSource(const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void advanceSearchFromTarget(const ConcreteGraph& graph);
+
+private:
+	DecoratedVertices<BidirectionalVertex> decoratedVertices;
+	Frontier frontierFromSource;
+	Frontier frontierFromTarget;
+	Frontier nextFrontier;
+	BidirectionalVertex* meetingVertex;
+	unsigned shortestPathLength;
+};
+
+#endif //__BIDIRECTIONAL_BFS_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
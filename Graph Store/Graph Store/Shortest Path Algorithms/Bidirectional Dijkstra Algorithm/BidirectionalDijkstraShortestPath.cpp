@@ -0,0 +1,233 @@
+#include "BidirectionalDijkstraShortestPath.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
+
+static ShortestPathAlgorithmRegistrator<BidirectionalDijkstraShortestPath> registrator("dijkstra-bidir");
+
+BidirectionalDijkstraShortestPath::BidirectionalDijkstraShortestPath(const String& id) :
+	ShortestPathAlgorithm(id),
+	meetingVertex(nullptr)
+{
+}
+
+void BidirectionalDijkstraShortestPath::initialise(const Graph& graph,
+												   const Vertex& source,
+												   const Vertex& target)
+{
+	decorateVerticesOf(graph);
+
+	meetingVertex = nullptr;
+	shortestPathLength = Distance::getInfinity();
+
+	BidirectionalVertex& decoratedSource = getDecoratedVersionOf(source);
+	initialiseSource(decoratedSource);
+	undeterminedFromSource.add(&decoratedSource);
+
+	BidirectionalVertex& decoratedTarget = getDecoratedVersionOf(target);
+	initialiseTarget(decoratedTarget);
+	undeterminedFromTarget.add(&decoratedTarget);
+
+	updateShortestPathThrough(decoratedSource);
+}
+
+void BidirectionalDijkstraShortestPath::decorateVerticesOf(const Graph& graph)
+{
+	decoratedVertices.startNewSession(graph.getVerticesCount());
+}
+
+void BidirectionalDijkstraShortestPath::initialiseTarget(BidirectionalVertex& target)
+{
+	target.successor = nullptr;
+	target.distanceToTarget = 0;
+}
+
+BidirectionalDijkstraShortestPath::BidirectionalVertex&
+BidirectionalDijkstraShortestPath::getDecoratedVersionOf(const Vertex& v)
+{
+	return decoratedVertices[v];
+}
+
+void BidirectionalDijkstraShortestPath::execute(const Graph& graph,
+												const Vertex& source,
+												const Vertex& target)
+{
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		searchIn(concreteGraph);
+	});
+
+	if (meetingVertex != nullptr)
+	{
+		joinPathsAt(*meetingVertex, target);
+	}
+}
+
+template <class ConcreteGraph>
+void BidirectionalDijkstraShortestPath::searchIn(const ConcreteGraph& graph)
+{
+	while (!canStopSearching())
+	{
+		if (isSearchFromSourceCloser())
+		{
+			advanceSearchFromSource(graph);
+		}
+		else
+		{
+			advanceSearchFromTarget(graph);
+		}
+	}
+}
+
+///
+/// Once either queue is empty, every vertex connected to its end is
+/// determined and every edge out of them relaxed, so the shortest path,
+/// if any, has already been seen.
+///
+bool BidirectionalDijkstraShortestPath::canStopSearching() const
+{
+	if (undeterminedFromSource.isEmpty() || undeterminedFromTarget.isEmpty())
+	{
+		return true;
+	}
+
+	Distance lowerBound = undeterminedFromSource.getOptimal()->distanceToSource
+						  + undeterminedFromTarget.getOptimal()->distanceToTarget;
+
+	return lowerBound >= shortestPathLength;
+}
+
+bool BidirectionalDijkstraShortestPath::isSearchFromSourceCloser() const
+{
+	return undeterminedFromSource.getOptimal()->distanceToSource
+		   <= undeterminedFromTarget.getOptimal()->distanceToTarget;
+}
+
+template <class ConcreteGraph>
+void BidirectionalDijkstraShortestPath::advanceSearchFromSource(const ConcreteGraph& graph)
+{
+	BidirectionalVertex* start = undeterminedFromSource.extractOptimal();
+
+	graph.forEachEdgeLeaving(*start->originalVertex, [&](const Edge& e)
+	{
+		BidirectionalVertex& end = getDecoratedVersionOf(e.getVertex());
+
+		relaxEdgeFromSource(*start, end, e.getWeight());
+	});
+}
+
+template <class ConcreteGraph>
+void BidirectionalDijkstraShortestPath::advanceSearchFromTarget(const ConcreteGraph& graph)
+{
+	BidirectionalVertex* end = undeterminedFromTarget.extractOptimal();
+
+	graph.forEachEdgeEntering(*end->originalVertex, [&](const Edge& e)
+	{
+		BidirectionalVertex& start = getDecoratedVersionOf(e.getVertex());
+
+		relaxEdgeFromTarget(*end, start, e.getWeight());
+	});
+}
+
+void BidirectionalDijkstraShortestPath::relaxEdgeFromSource(const BidirectionalVertex& start,
+															BidirectionalVertex& end,
+															unsigned weight)
+{
+	Distance distanceThroughStart = start.distanceToSource + weight;
+
+	if (distanceThroughStart < end.distanceToSource)
+	{
+		if (end.parent == nullptr)
+		{
+			end.distanceToSource = distanceThroughStart;
+			undeterminedFromSource.add(&end);
+		}
+		else
+		{
+			undeterminedFromSource.optimiseKey(end.handleFromSource, distanceThroughStart);
+		}
+
+		end.parent = &start;
+		updateShortestPathThrough(end);
+	}
+}
+
+void BidirectionalDijkstraShortestPath::relaxEdgeFromTarget(BidirectionalVertex& end,
+															BidirectionalVertex& start,
+															unsigned weight)
+{
+	Distance distanceThroughEnd = end.distanceToTarget + weight;
+
+	if (distanceThroughEnd < start.distanceToTarget)
+	{
+		if (start.successor == nullptr)
+		{
+			start.distanceToTarget = distanceThroughEnd;
+			undeterminedFromTarget.add(&start);
+		}
+		else
+		{
+			undeterminedFromTarget.optimiseKey(start.handleFromTarget, distanceThroughEnd);
+		}
+
+		start.successor = &end;
+		updateShortestPathThrough(start);
+	}
+}
+
+void BidirectionalDijkstraShortestPath::updateShortestPathThrough(BidirectionalVertex& v)
+{
+	Distance lengthOfPathThroughV = v.distanceToSource + v.distanceToTarget;
+
+	if (lengthOfPathThroughV < shortestPathLength)
+	{
+		shortestPathLength = lengthOfPathThroughV;
+		meetingVertex = &v;
+	}
+}
+
+///
+/// Turns the path from the meeting vertex to the target into parent links,
+/// so the path is collected as if it was found by a search from the source.
+/// With zero-weight edges the two halves may share vertices, which keep
+/// their parents on the path from the source so that no cycle is formed.
+/// Only the target needs a distance to the source.
+///
+void BidirectionalDijkstraShortestPath::joinPathsAt(BidirectionalVertex& v,
+													const Vertex& target)
+{
+	markPathFromSourceTo(v);
+
+	BidirectionalVertex* current = &v;
+
+	while (current->successor != nullptr)
+	{
+		BidirectionalVertex* next = current->successor;
+
+		if (!next->isOnPathFromSource)
+		{
+			next->parent = current;
+		}
+
+		current = next;
+	}
+
+	getDecoratedVersionOf(target).distanceToSource = shortestPathLength;
+}
+
+void BidirectionalDijkstraShortestPath::markPathFromSourceTo(const BidirectionalVertex& v)
+{
+	const DecoratedVertex* current = &v;
+
+	while (current != nullptr)
+	{
+		getDecoratedVersionOf(*current->originalVertex).isOnPathFromSource = true;
+
+		current = current->parent;
+	}
+}
+
+void BidirectionalDijkstraShortestPath::cleanUp()
+{
+	undeterminedFromSource.empty();
+	undeterminedFromTarget.empty();
+}
\ No newline at end of file
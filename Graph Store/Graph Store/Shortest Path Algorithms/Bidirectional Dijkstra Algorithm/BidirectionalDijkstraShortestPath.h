@@ -0,0 +1,125 @@
+#ifndef __BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
+#define __BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../Decorated Vertices/DecoratedVertices.h"
+#include "../../Priority Queue/PriorityQueue.h"
+
+///
+/// Runs Dijkstra's algorithm forward from the source and backward from the
+/// target, over the edges entering each vertex, always advancing the search
+/// whose next vertex is closer to its end.
+///
+/// Every time a vertex gets a better estimate from either side, the length
+/// of the shortest path through it seen so far is updated. The searches stop
+/// once the sum of the keys on top of the two queues reaches that length,
+/// since no path through an undetermined vertex can be shorter then.
+///
+class BidirectionalDijkstraShortestPath : public ShortestPathAlgorithm
+{
+	struct BidirectionalVertex : public DecoratedVertex
+	{
+		BidirectionalVertex(const Vertex* originalVertex = nullptr) :
+			DecoratedVertex(originalVertex),
+			successor(nullptr),
+			distanceToTarget(Distance::getInfinity()),
+			isOnPathFromSource(false)
+		{
+		}
+
+		BidirectionalVertex* successor;
+		Distance distanceToTarget;
+		PriorityQueueHandle handleFromSource;
+		PriorityQueueHandle handleFromTarget;
+		bool isOnPathFromSource;
+	};
+
+	class KeyFromSourceAccessor
+	{
+	public:
+		const Distance& getKeyOf(const BidirectionalVertex* v) const
+		{
+			return v->distanceToSource;
+		}
+
+		void setKeyOfWith(BidirectionalVertex* v, const Distance& d) const
+		{
+			v->distanceToSource = d;
+		}
+	};
+
+	class KeyFromTargetAccessor
+	{
+	public:
+		const Distance& getKeyOf(const BidirectionalVertex* v) const
+		{
+			return v->distanceToTarget;
+		}
+
+		void setKeyOfWith(BidirectionalVertex* v, const Distance& d) const
+		{
+			v->distanceToTarget = d;
+		}
+	};
+
+	class HandleFromSourceUpdator
+	{
+	public:
+		void operator()(BidirectionalVertex* v, const PriorityQueueHandle& h) const
+		{
+			v->handleFromSource = h;
+		}
+	};
+
+	class HandleFromTargetUpdator
+	{
+	public:
+		void operator()(BidirectionalVertex* v, const PriorityQueueHandle& h) const
+		{
+			v->handleFromTarget = h;
+		}
+	};
+
+	typedef PriorityQueue<BidirectionalVertex*, Less, Distance,
+						  KeyFromSourceAccessor, HandleFromSourceUpdator, 4> QueueFromSource;
+	typedef PriorityQueue<BidirectionalVertex*, Less, Distance,
+						  KeyFromTargetAccessor, HandleFromTargetUpdator, 4> QueueFromTarget;
+
+public:
+	explicit BidirectionalDijkstraShortestPath(const String& id);
+	BidirectionalDijkstraShortestPath(const BidirectionalDijkstraShortestPath&) = delete;
+	BidirectionalDijkstraShortestPath& operator=(const BidirectionalDijkstraShortestPath&) = delete;
+
+private:
+	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void cleanUp() override;
+	virtual BidirectionalVertex& getDecoratedVersionOf(const Vertex& vertex) override;
+	void decorateVerticesOf(const Graph& graph);
+	void initialiseTarget(BidirectionalVertex& target);
+	void relaxEdgeFromSource(const BidirectionalVertex& start, BidirectionalVertex& end, unsigned weight);
+	void relaxEdgeFromTarget(BidirectionalVertex& end, BidirectionalVertex& start, unsigned weight);
+	void updateShortestPathThrough(BidirectionalVertex& v);
+	bool canStopSearching() const;
+	bool isSearchFromSourceCloser() const;
+	void joinPathsAt(BidirectionalVertex& v, const Vertex& target);
+	void markPathFromSourceTo(const BidirectionalVertex& v);
+
+	template <class ConcreteGraph>
+	void searchIn(const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void advanceSearchFromSource(const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void advanceSearchFromTarget(const ConcreteGraph& graph);
+
+private:
+	QueueFromSource undeterminedFromSource;
+	QueueFromTarget undeterminedFromTarget;
+	DecoratedVertices<BidirectionalVertex> decoratedVertices;
+	BidirectionalVertex* meetingVertex;
+	Distance shortestPathLength;
+};
+
+#endif //__BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include "CHShortestPath.h"
+#include "../../Graph/Static Graph/StaticGraph.h"
+#include "../../Runtime Error/RuntimeError.h"
+#include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
+#include <algorithm>
+
+static ShortestPathAlgorithmRegistrator<CHShortestPath> registrator("ch");
+
+const size_t CHShortestPath::NOT_ON_PATH;
+
+CHShortestPath::CHShortestPath(const String& id) :
+	ShortestPathAlgorithm(id),
+	hierarchy(nullptr),
+	meetingVertex(nullptr)
+{
+}
+
+void CHShortestPath::initialise(const Graph& graph,
+								const Vertex& source,
+								const Vertex& target)
+{
+	hierarchy = &getHierarchyOf(graph);
+
+	decorateVerticesOf(graph);
+
+	meetingVertex = nullptr;
+	shortestPathLength = Distance::getInfinity();
+
+	CHVertex& decoratedSource = getDecoratedVersionOf(source);
+	initialiseSource(decoratedSource);
+	undeterminedFromSource.add(&decoratedSource);
+
+	CHVertex& decoratedTarget = getDecoratedVersionOf(target);
+	initialiseTarget(decoratedTarget);
+	undeterminedFromTarget.add(&decoratedTarget);
+
+	updateShortestPathThrough(decoratedSource);
+}
+
+const ContractionHierarchy& CHShortestPath::getHierarchyOf(const Graph& graph)
+{
+	const StaticGraph* staticGraph = dynamic_cast<const StaticGraph*>(&graph);
+	const ContractionHierarchy* hierarchy =
+		(staticGraph != nullptr) ? staticGraph->getContractionHierarchy() : nullptr;
+
+	if (hierarchy == nullptr)
+	{
+		throw RuntimeError("The graph has no contraction hierarchy: " + graph.getID());
+	}
+
+	return *hierarchy;
+}
+
+void CHShortestPath::decorateVerticesOf(const Graph& graph)
+{
+	decoratedVertices.startNewSession(graph.getVerticesCount());
+}
+
+void CHShortestPath::initialiseTarget(CHVertex& target)
+{
+	target.successor = nullptr;
+	target.distanceToTarget = 0;
+}
+
+CHShortestPath::CHVertex& CHShortestPath::getDecoratedVersionOf(const Vertex& v)
+{
+	return decoratedVertices[v];
+}
+
+void CHShortestPath::execute(const Graph&,
+							 const Vertex&,
+							 const Vertex& target)
+{
+	searchUpwards();
+
+	if (meetingVertex != nullptr)
+	{
+		collectPathThrough(*meetingVertex);
+		unpackPath();
+		setParentsAlongPath();
+
+		getDecoratedVersionOf(target).distanceToSource = shortestPathLength;
+	}
+}
+
+///
+/// Each search advances while its next vertex may still lie on a shorter
+/// path, the one whose next vertex is closer to its end first.
+///
+void CHShortestPath::searchUpwards()
+{
+	bool isSourceDone = isSearchFromSourceDone();
+	bool isTargetDone = isSearchFromTargetDone();
+
+	while (!isSourceDone || !isTargetDone)
+	{
+		if (isTargetDone
+			|| (!isSourceDone
+				&& undeterminedFromSource.getOptimal()->distanceToSource
+				   <= undeterminedFromTarget.getOptimal()->distanceToTarget))
+		{
+			advanceSearchFromSource();
+			isSourceDone = isSearchFromSourceDone();
+		}
+		else
+		{
+			advanceSearchFromTarget();
+			isTargetDone = isSearchFromTargetDone();
+		}
+	}
+}
+
+bool CHShortestPath::isSearchFromSourceDone() const
+{
+	return undeterminedFromSource.isEmpty()
+		   || undeterminedFromSource.getOptimal()->distanceToSource >= shortestPathLength;
+}
+
+bool CHShortestPath::isSearchFromTargetDone() const
+{
+	return undeterminedFromTarget.isEmpty()
+		   || undeterminedFromTarget.getOptimal()->distanceToTarget >= shortestPathLength;
+}
+
+void CHShortestPath::advanceSearchFromSource()
+{
+	CHVertex* start = undeterminedFromSource.extractOptimal();
+
+	hierarchy->forEachUpwardEdgeLeaving(*start->originalVertex, [&](const Vertex& v, unsigned weight)
+	{
+		relaxEdgeFromSource(*start, getDecoratedVersionOf(v), weight);
+	});
+}
+
+void CHShortestPath::advanceSearchFromTarget()
+{
+	CHVertex* end = undeterminedFromTarget.extractOptimal();
+
+	hierarchy->forEachUpwardEdgeEntering(*end->originalVertex, [&](const Vertex& v, unsigned weight)
+	{
+		relaxEdgeFromTarget(*end, getDecoratedVersionOf(v), weight);
+	});
+}
+
+void CHShortestPath::relaxEdgeFromSource(const CHVertex& start,
+										 CHVertex& end,
+										 unsigned weight)
+{
+	Distance distanceThroughStart = start.distanceToSource + weight;
+
+	if (distanceThroughStart < end.distanceToSource)
+	{
+		if (end.parent == nullptr)
+		{
+			end.distanceToSource = distanceThroughStart;
+			undeterminedFromSource.add(&end);
+		}
+		else
+		{
+			undeterminedFromSource.optimiseKey(end.handleFromSource, distanceThroughStart);
+		}
+
+		end.parent = &start;
+		updateShortestPathThrough(end);
+	}
+}
+
+void CHShortestPath::relaxEdgeFromTarget(const CHVertex& end,
+										 CHVertex& start,
+										 unsigned weight)
+{
+	Distance distanceThroughEnd = end.distanceToTarget + weight;
+
+	if (distanceThroughEnd < start.distanceToTarget)
+	{
+		if (start.successor == nullptr)
+		{
+			start.distanceToTarget = distanceThroughEnd;
+			undeterminedFromTarget.add(&start);
+		}
+		else
+		{
+			undeterminedFromTarget.optimiseKey(start.handleFromTarget, distanceThroughEnd);
+		}
+
+		start.successor = &end;
+		updateShortestPathThrough(start);
+	}
+}
+
+void CHShortestPath::updateShortestPathThrough(const CHVertex& v)
+{
+	Distance lengthOfPathThroughV = v.distanceToSource + v.distanceToTarget;
+
+	if (lengthOfPathThroughV < shortestPathLength)
+	{
+		shortestPathLength = lengthOfPathThroughV;
+		meetingVertex = &v;
+	}
+}
+
+///
+/// Collects the indices of the vertices on the path in the hierarchy: the
+/// parents from the meeting vertex down to the source, reversed, followed
+/// by the successors from the meeting vertex down to the target.
+///
+void CHShortestPath::collectPathThrough(const CHVertex& v)
+{
+	hierarchyPath.clear();
+
+	for (const DecoratedVertex* current = &v; current != nullptr; current = current->parent)
+	{
+		hierarchyPath.push_back(current->originalVertex->getIndex());
+	}
+
+	std::reverse(hierarchyPath.begin(), hierarchyPath.end());
+
+	for (const CHVertex* current = v.successor; current != nullptr; current = current->successor)
+	{
+		hierarchyPath.push_back(current->originalVertex->getIndex());
+	}
+}
+
+void CHShortestPath::unpackPath()
+{
+	path.clear();
+	path.push_back(hierarchyPath.front());
+
+	for (size_t i = 1; i < hierarchyPath.size(); ++i)
+	{
+		hierarchy->appendUnpackedEdge(hierarchyPath[i - 1], hierarchyPath[i], path);
+	}
+
+	removeLoopsFromPath();
+}
+
+///
+/// With zero-weight edges the two halves of the path, or two unpacked
+/// shortcuts, may go through the same vertex. The zero-weight loop between
+/// the two visits is cut off, so the parents do not form a cycle.
+///
+void CHShortestPath::removeLoopsFromPath()
+{
+	size_t length = 0;
+
+	for (size_t vertexIndex : path)
+	{
+		CHVertex& v = getDecoratedVersionOf(hierarchy->getVertexAt(vertexIndex));
+
+		if (v.positionOnPath == NOT_ON_PATH)
+		{
+			v.positionOnPath = length;
+			path[length++] = vertexIndex;
+		}
+		else
+		{
+			for (size_t i = v.positionOnPath + 1; i < length; ++i)
+			{
+				getDecoratedVersionOf(hierarchy->getVertexAt(path[i])).positionOnPath = NOT_ON_PATH;
+			}
+
+			length = v.positionOnPath + 1;
+		}
+	}
+
+	path.resize(length);
+}
+
+void CHShortestPath::setParentsAlongPath()
+{
+	const CHVertex* previous = nullptr;
+
+	for (size_t vertexIndex : path)
+	{
+		CHVertex& v = getDecoratedVersionOf(hierarchy->getVertexAt(vertexIndex));
+		v.parent = previous;
+
+		previous = &v;
+	}
+}
+
+void CHShortestPath::cleanUp()
+{
+	undeterminedFromSource.empty();
+	undeterminedFromTarget.empty();
+}
\ No newline at end of file
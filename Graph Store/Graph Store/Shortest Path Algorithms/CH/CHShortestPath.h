@@ -0,0 +1,133 @@
+#ifndef __CH_SHORTEST_PATH_HEADER_INCLUDED__
+#define __CH_SHORTEST_PATH_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../Decorated Vertices/DecoratedVertices.h"
+#include "../Contraction Hierarchy/ContractionHierarchy.h"
+#include "../../Priority Queue/PriorityQueue.h"
+
+///
+/// Answers queries with the contraction hierarchy of a frozen graph (see
+/// PREPROCESS-HIERARCHY): Dijkstra's algorithm runs forward from the source
+/// and backward from the target, each over the edges leading up the
+/// hierarchy only. Every shortest path has a highest vertex, which both
+/// searches reach, so each of them can stop once the key on top of its
+/// queue reaches the length of the shortest path seen so far.
+///
+/// The path found consists of edges and shortcuts, which are unpacked into
+/// the edges of the graph before the parents are set along it.
+///
+class CHShortestPath : public ShortestPathAlgorithm
+{
+	struct CHVertex : public DecoratedVertex
+	{
+		CHVertex(const Vertex* originalVertex = nullptr) :
+			DecoratedVertex(originalVertex),
+			successor(nullptr),
+			distanceToTarget(Distance::getInfinity()),
+			positionOnPath(NOT_ON_PATH)
+		{
+		}
+
+		const CHVertex* successor;
+		Distance distanceToTarget;
+		PriorityQueueHandle handleFromSource;
+		PriorityQueueHandle handleFromTarget;
+		size_t positionOnPath;
+	};
+
+	class KeyFromSourceAccessor
+	{
+	public:
+		const Distance& getKeyOf(const CHVertex* v) const
+		{
+			return v->distanceToSource;
+		}
+
+		void setKeyOfWith(CHVertex* v, const Distance& d) const
+		{
+			v->distanceToSource = d;
+		}
+	};
+
+	class KeyFromTargetAccessor
+	{
+	public:
+		const Distance& getKeyOf(const CHVertex* v) const
+		{
+			return v->distanceToTarget;
+		}
+
+		void setKeyOfWith(CHVertex* v, const Distance& d) const
+		{
+			v->distanceToTarget = d;
+		}
+	};
+
+	class HandleFromSourceUpdator
+	{
+	public:
+		void operator()(CHVertex* v, const PriorityQueueHandle& h) const
+		{
+			v->handleFromSource = h;
+		}
+	};
+
+	class HandleFromTargetUpdator
+	{
+	public:
+		void operator()(CHVertex* v, const PriorityQueueHandle& h) const
+		{
+			v->handleFromTarget = h;
+		}
+	};
+
+	typedef PriorityQueue<CHVertex*, Less, Distance,
+						  KeyFromSourceAccessor, HandleFromSourceUpdator, 4> QueueFromSource;
+	typedef PriorityQueue<CHVertex*, Less, Distance,
+						  KeyFromTargetAccessor, HandleFromTargetUpdator, 4> QueueFromTarget;
+	typedef ContractionHierarchy::IndicesArray IndicesArray;
+
+public:
+	explicit CHShortestPath(const String& id);
+	CHShortestPath(const CHShortestPath&) = delete;
+	CHShortestPath& operator=(const CHShortestPath&) = delete;
+
+private:
+	static const size_t NOT_ON_PATH = static_cast<size_t>(-1);
+
+private:
+	static const ContractionHierarchy& getHierarchyOf(const Graph& graph);
+
+private:
+	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void cleanUp() override;
+	virtual CHVertex& getDecoratedVersionOf(const Vertex& vertex) override;
+	void decorateVerticesOf(const Graph& graph);
+	void initialiseTarget(CHVertex& target);
+	void searchUpwards();
+	void advanceSearchFromSource();
+	void advanceSearchFromTarget();
+	void relaxEdgeFromSource(const CHVertex& start, CHVertex& end, unsigned weight);
+	void relaxEdgeFromTarget(const CHVertex& end, CHVertex& start, unsigned weight);
+	void updateShortestPathThrough(const CHVertex& v);
+	bool isSearchFromSourceDone() const;
+	bool isSearchFromTargetDone() const;
+	void collectPathThrough(const CHVertex& v);
+	void unpackPath();
+	void removeLoopsFromPath();
+	void setParentsAlongPath();
+
+private:
+	QueueFromSource undeterminedFromSource;
+	QueueFromTarget undeterminedFromTarget;
+	DecoratedVertices<CHVertex> decoratedVertices;
+	IndicesArray hierarchyPath;
+	IndicesArray path;
+	const ContractionHierarchy* hierarchy;
+	const CHVertex* meetingVertex;
+	Distance shortestPathLength;
+};
+
+#endif //__CH_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,518 @@
+#include "ContractionHierarchy.h"
+#include "../../Graph/Static Graph/StaticGraph.h"
+#include "../../Priority Queue/PriorityQueue.h"
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <assert.h>
+
+const std::uint32_t ContractionHierarchy::NO_MIDDLE;
+
+///
+/// Keeps the graph which remains to be contracted as lists of the edges
+/// leaving and entering each vertex, and the edges of the contracted
+/// vertices as the upward and downward lists of the hierarchy.
+///
+class ContractionHierarchy::Builder
+{
+	typedef std::vector<HierarchyEdge> EdgesList;
+	typedef std::vector<EdgesList> EdgesLists;
+
+	struct Shortcut
+	{
+		std::uint32_t startIndex;
+		std::uint32_t endIndex;
+		std::uint32_t weight;
+	};
+
+	struct ContractionCandidate
+	{
+		ContractionCandidate(size_t vertexIndex = 0, long priority = 0) :
+			vertexIndex(vertexIndex),
+			priority(priority)
+		{
+		}
+
+		bool operator<(const ContractionCandidate& rhs) const
+		{
+			return priority < rhs.priority;
+		}
+
+		size_t vertexIndex;
+		long priority;
+	};
+
+	struct WitnessSearchEntry
+	{
+		WitnessSearchEntry(size_t vertexIndex = 0, unsigned distance = 0) :
+			vertexIndex(vertexIndex),
+			distance(distance)
+		{
+		}
+
+		bool operator<(const WitnessSearchEntry& rhs) const
+		{
+			return distance < rhs.distance;
+		}
+
+		size_t vertexIndex;
+		unsigned distance;
+	};
+
+	typedef std::vector<Shortcut> ShortcutsArray;
+
+public:
+	Builder(const StaticGraph& graph, ContractionHierarchy& hierarchy);
+	Builder(const Builder&) = delete;
+	Builder& operator=(const Builder&) = delete;
+
+	void build();
+
+private:
+	static const size_t WITNESS_SEARCH_SETTLED_LIMIT = 500;
+	static const unsigned UNREACHABLE = static_cast<unsigned>(-1);
+
+private:
+	static bool addOrImproveEdge(EdgesList& edges,
+								 std::uint32_t vertexIndex,
+								 std::uint32_t weight,
+								 std::uint32_t middleIndex);
+	static void removeEdgeTo(EdgesList& edges, size_t vertexIndex);
+	static void buildArrayFrom(EdgesLists& lists, EdgesArray& edges, OffsetsArray& offsets);
+
+private:
+	void copyEdgesOf(const StaticGraph& graph);
+	void contractVerticesInOrder();
+	long computePriorityOf(size_t vertexIndex, ShortcutsArray& shortcuts);
+	void contract(size_t vertexIndex, std::uint32_t rank, const ShortcutsArray& shortcuts);
+	void disconnect(size_t vertexIndex);
+	void findShortcutsAround(size_t vertexIndex, ShortcutsArray& shortcuts);
+	void searchForWitnesses(size_t sourceIndex, size_t excludedIndex, unsigned limit);
+	void resetWitnessSearch();
+	void addShortcuts(const ShortcutsArray& shortcuts, size_t middleIndex);
+
+private:
+	ContractionHierarchy& hierarchy;
+	EdgesLists outgoing;
+	EdgesLists incoming;
+	EdgesLists upward;
+	EdgesLists downward;
+	std::vector<unsigned> contractedNeighboursCounts;
+	std::vector<unsigned> witnessDistances;
+	std::vector<size_t> reachedByWitnessSearch;
+};
+
+const unsigned ContractionHierarchy::Builder::UNREACHABLE;
+
+ContractionHierarchy::Builder::Builder(const StaticGraph& graph, ContractionHierarchy& hierarchy) :
+	hierarchy(hierarchy),
+	outgoing(graph.getVerticesCount()),
+	incoming(graph.getVerticesCount()),
+	upward(graph.getVerticesCount()),
+	downward(graph.getVerticesCount()),
+	contractedNeighboursCounts(graph.getVerticesCount(), 0),
+	witnessDistances(graph.getVerticesCount(), UNREACHABLE)
+{
+	copyEdgesOf(graph);
+}
+
+void ContractionHierarchy::Builder::copyEdgesOf(const StaticGraph& graph)
+{
+	for (const Vertex* v : hierarchy.vertices)
+	{
+		std::uint32_t startIndex = static_cast<std::uint32_t>(v->getIndex());
+
+		graph.forEachEdgeLeaving(*v, [&](const Edge& e)
+		{
+			std::uint32_t endIndex = static_cast<std::uint32_t>(e.getVertex().getIndex());
+
+			if (startIndex != endIndex)
+			{
+				addOrImproveEdge(outgoing[startIndex], endIndex, e.getWeight(), NO_MIDDLE);
+				addOrImproveEdge(incoming[endIndex], startIndex, e.getWeight(), NO_MIDDLE);
+			}
+		});
+	}
+}
+
+void ContractionHierarchy::Builder::build()
+{
+	contractVerticesInOrder();
+
+	buildArrayFrom(upward, hierarchy.upwardEdges, hierarchy.upwardOffsets);
+	buildArrayFrom(downward, hierarchy.downwardEdges, hierarchy.downwardOffsets);
+}
+
+///
+/// The priorities change as the neighbours of a vertex are contracted, so
+/// they are updated lazily: the priority of the vertex on top of the queue
+/// is recomputed and the vertex is put back if it is no longer the lowest.
+///
+void ContractionHierarchy::Builder::contractVerticesInOrder()
+{
+	PriorityQueue<ContractionCandidate> queue;
+	ShortcutsArray shortcuts;
+
+	for (size_t i = 0; i < hierarchy.vertices.size(); ++i)
+	{
+		queue.add(ContractionCandidate(i, computePriorityOf(i, shortcuts)));
+	}
+
+	std::uint32_t rank = 0;
+
+	while (!queue.isEmpty())
+	{
+		size_t vertexIndex = queue.extractOptimal().vertexIndex;
+		long priority = computePriorityOf(vertexIndex, shortcuts);
+
+		if (!queue.isEmpty() && priority > queue.getOptimal().priority)
+		{
+			queue.add(ContractionCandidate(vertexIndex, priority));
+		}
+		else
+		{
+			contract(vertexIndex, rank++, shortcuts);
+		}
+	}
+}
+
+///
+/// Leaves the shortcuts the contraction of the vertex needs in shortcuts.
+///
+long ContractionHierarchy::Builder::computePriorityOf(size_t vertexIndex, ShortcutsArray& shortcuts)
+{
+	shortcuts.clear();
+	findShortcutsAround(vertexIndex, shortcuts);
+
+	long edgeDifference = static_cast<long>(shortcuts.size())
+						  - static_cast<long>(outgoing[vertexIndex].size())
+						  - static_cast<long>(incoming[vertexIndex].size());
+
+	return edgeDifference + contractedNeighboursCounts[vertexIndex];
+}
+
+void ContractionHierarchy::Builder::contract(size_t vertexIndex,
+											 std::uint32_t rank,
+											 const ShortcutsArray& shortcuts)
+{
+	hierarchy.ranks[vertexIndex] = rank;
+
+	disconnect(vertexIndex);
+	addShortcuts(shortcuts, vertexIndex);
+}
+
+///
+/// All the neighbours of a vertex being contracted are still in the graph,
+/// so its edges go up the hierarchy and become its upward and downward
+/// lists as they are.
+///
+void ContractionHierarchy::Builder::disconnect(size_t vertexIndex)
+{
+	upward[vertexIndex] = std::move(outgoing[vertexIndex]);
+	downward[vertexIndex] = std::move(incoming[vertexIndex]);
+	outgoing[vertexIndex].clear();
+	incoming[vertexIndex].clear();
+
+	for (const HierarchyEdge& e : upward[vertexIndex])
+	{
+		removeEdgeTo(incoming[e.vertexIndex], vertexIndex);
+		++contractedNeighboursCounts[e.vertexIndex];
+	}
+
+	for (const HierarchyEdge& e : downward[vertexIndex])
+	{
+		removeEdgeTo(outgoing[e.vertexIndex], vertexIndex);
+		++contractedNeighboursCounts[e.vertexIndex];
+	}
+}
+
+void ContractionHierarchy::Builder::findShortcutsAround(size_t vertexIndex, ShortcutsArray& shortcuts)
+{
+	const EdgesList& edgesLeaving = outgoing[vertexIndex];
+
+	if (edgesLeaving.empty())
+	{
+		return;
+	}
+
+	std::uint32_t maxWeightLeaving = std::max_element(edgesLeaving.cbegin(), edgesLeaving.cend(),
+		[](const HierarchyEdge& lhs, const HierarchyEdge& rhs)
+	{
+		return lhs.weight < rhs.weight;
+	})->weight;
+
+	for (const HierarchyEdge& in : incoming[vertexIndex])
+	{
+		searchForWitnesses(in.vertexIndex, vertexIndex, in.weight + maxWeightLeaving);
+
+		for (const HierarchyEdge& out : edgesLeaving)
+		{
+			std::uint32_t weightThroughVertex = in.weight + out.weight;
+
+			if (out.vertexIndex != in.vertexIndex
+				&& witnessDistances[out.vertexIndex] > weightThroughVertex)
+			{
+				shortcuts.push_back({ in.vertexIndex, out.vertexIndex, weightThroughVertex });
+			}
+		}
+
+		resetWitnessSearch();
+	}
+}
+
+///
+/// Runs Dijkstra's algorithm in the remaining graph without the excluded
+/// vertex, until the distances exceed limit or enough vertices are
+/// determined. A witness it misses only costs an unnecessary shortcut.
+///
+void ContractionHierarchy::Builder::searchForWitnesses(size_t sourceIndex,
+														size_t excludedIndex,
+														unsigned limit)
+{
+	PriorityQueue<WitnessSearchEntry> queue;
+	size_t determinedCount = 0;
+
+	witnessDistances[sourceIndex] = 0;
+	reachedByWitnessSearch.push_back(sourceIndex);
+	queue.add(WitnessSearchEntry(sourceIndex, 0));
+
+	while (!queue.isEmpty() && determinedCount < WITNESS_SEARCH_SETTLED_LIMIT)
+	{
+		WitnessSearchEntry entry = queue.extractOptimal();
+
+		if (entry.distance > limit)
+		{
+			break;
+		}
+
+		if (entry.distance != witnessDistances[entry.vertexIndex])
+		{
+			continue;
+		}
+
+		++determinedCount;
+
+		for (const HierarchyEdge& e : outgoing[entry.vertexIndex])
+		{
+			unsigned distanceThroughEntry = entry.distance + e.weight;
+
+			if (e.vertexIndex != excludedIndex
+				&& distanceThroughEntry < witnessDistances[e.vertexIndex])
+			{
+				if (witnessDistances[e.vertexIndex] == UNREACHABLE)
+				{
+					reachedByWitnessSearch.push_back(e.vertexIndex);
+				}
+
+				witnessDistances[e.vertexIndex] = distanceThroughEntry;
+				queue.add(WitnessSearchEntry(e.vertexIndex, distanceThroughEntry));
+			}
+		}
+	}
+}
+
+void ContractionHierarchy::Builder::resetWitnessSearch()
+{
+	for (size_t vertexIndex : reachedByWitnessSearch)
+	{
+		witnessDistances[vertexIndex] = UNREACHABLE;
+	}
+
+	reachedByWitnessSearch.clear();
+}
+
+void ContractionHierarchy::Builder::addShortcuts(const ShortcutsArray& shortcuts, size_t middleIndex)
+{
+	std::uint32_t middle = static_cast<std::uint32_t>(middleIndex);
+
+	for (const Shortcut& s : shortcuts)
+	{
+		if (addOrImproveEdge(outgoing[s.startIndex], s.endIndex, s.weight, middle))
+		{
+			bool addedIncomingEdge = addOrImproveEdge(incoming[s.endIndex], s.startIndex, s.weight, middle);
+			assert(addedIncomingEdge);
+		}
+	}
+}
+
+///
+/// Keeps at most one edge to each vertex, the lightest one.
+///
+bool ContractionHierarchy::Builder::addOrImproveEdge(EdgesList& edges,
+													  std::uint32_t vertexIndex,
+													  std::uint32_t weight,
+													  std::uint32_t middleIndex)
+{
+	for (HierarchyEdge& e : edges)
+	{
+		if (e.vertexIndex == vertexIndex)
+		{
+			if (weight < e.weight)
+			{
+				e.weight = weight;
+				e.middleIndex = middleIndex;
+
+				return true;
+			}
+
+			return false;
+		}
+	}
+
+	edges.push_back({ vertexIndex, weight, middleIndex });
+
+	return true;
+}
+
+void ContractionHierarchy::Builder::removeEdgeTo(EdgesList& edges, size_t vertexIndex)
+{
+	for (size_t i = 0; i < edges.size(); ++i)
+	{
+		if (edges[i].vertexIndex == vertexIndex)
+		{
+			edges[i] = edges.back();
+			edges.pop_back();
+
+			return;
+		}
+	}
+}
+
+void ContractionHierarchy::Builder::buildArrayFrom(EdgesLists& lists,
+												   EdgesArray& edges,
+												   OffsetsArray& offsets)
+{
+	offsets.reserve(lists.size() + 1);
+
+	for (EdgesList& list : lists)
+	{
+		offsets.push_back(edges.size());
+		edges.insert(edges.end(), list.cbegin(), list.cend());
+
+		EdgesList().swap(list);
+	}
+
+	offsets.push_back(edges.size());
+}
+
+ContractionHierarchy::ContractionHierarchy(const StaticGraph& graph) :
+	ranks(graph.getVerticesCount()),
+	shortcutsCount(0)
+{
+	collectVerticesOf(graph);
+
+	Builder(graph, *this).build();
+
+	shortcutsCount = countShortcutsIn(upwardEdges) + countShortcutsIn(downwardEdges);
+}
+
+///
+/// Takes over the arrays of a hierarchy of graph which was built before,
+/// as SnapshotReader reads them.
+///
+ContractionHierarchy::ContractionHierarchy(const StaticGraph& graph,
+										   RanksArray&& ranks,
+										   OffsetsArray&& upwardOffsets,
+										   EdgesArray&& upwardEdges,
+										   OffsetsArray&& downwardOffsets,
+										   EdgesArray&& downwardEdges) :
+	ranks(std::move(ranks)),
+	upwardOffsets(std::move(upwardOffsets)),
+	upwardEdges(std::move(upwardEdges)),
+	downwardOffsets(std::move(downwardOffsets)),
+	downwardEdges(std::move(downwardEdges))
+{
+	assert(this->ranks.size() == graph.getVerticesCount());
+	assert(this->upwardOffsets.size() == graph.getVerticesCount() + 1);
+	assert(this->downwardOffsets.size() == graph.getVerticesCount() + 1);
+
+	collectVerticesOf(graph);
+
+	shortcutsCount = countShortcutsIn(this->upwardEdges) + countShortcutsIn(this->downwardEdges);
+}
+
+void ContractionHierarchy::collectVerticesOf(const StaticGraph& graph)
+{
+	vertices.resize(graph.getVerticesCount());
+
+	forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+	{
+		vertices[v->getIndex()] = v;
+	});
+}
+
+size_t ContractionHierarchy::countShortcutsIn(const EdgesArray& edges)
+{
+	return std::count_if(edges.cbegin(), edges.cend(), [](const HierarchyEdge& e)
+	{
+		return e.middleIndex != NO_MIDDLE;
+	});
+}
+
+///
+/// Replaces shortcuts by the two edges they stand for until only edges of
+/// the graph remain, and appends the vertices after the start to path.
+/// The pairs still to unpack are kept on a stack rather than recursing, as
+/// shortcuts on large graphs can be nested deeply.
+///
+void ContractionHierarchy::appendUnpackedEdge(size_t startIndex,
+											  size_t endIndex,
+											  IndicesArray& path) const
+{
+	std::vector<std::pair<size_t, size_t>> edgesToUnpack;
+	edgesToUnpack.emplace_back(startIndex, endIndex);
+
+	while (!edgesToUnpack.empty())
+	{
+		std::pair<size_t, size_t> edge = edgesToUnpack.back();
+		edgesToUnpack.pop_back();
+
+		std::uint32_t middleIndex = findEdge(edge.first, edge.second).middleIndex;
+
+		if (middleIndex == NO_MIDDLE)
+		{
+			path.push_back(edge.second);
+		}
+		else
+		{
+			edgesToUnpack.emplace_back(middleIndex, edge.second);
+			edgesToUnpack.emplace_back(edge.first, middleIndex);
+		}
+	}
+}
+
+///
+/// An edge is kept at the end of lower rank, which was contracted first.
+///
+const ContractionHierarchy::HierarchyEdge&
+ContractionHierarchy::findEdge(size_t startIndex, size_t endIndex) const
+{
+	bool leadsUpwards = ranks[startIndex] < ranks[endIndex];
+	size_t ownerIndex = leadsUpwards ? startIndex : endIndex;
+	size_t otherEndIndex = leadsUpwards ? endIndex : startIndex;
+	const EdgesArray& edges = leadsUpwards ? upwardEdges : downwardEdges;
+	const OffsetsArray& offsets = leadsUpwards ? upwardOffsets : downwardOffsets;
+
+	for (size_t i = offsets[ownerIndex]; i < offsets[ownerIndex + 1]; ++i)
+	{
+		if (edges[i].vertexIndex == otherEndIndex)
+		{
+			return edges[i];
+		}
+	}
+
+	assert(false);
+	throw std::logic_error("The hierarchy has no such edge!");
+}
+
+const Vertex& ContractionHierarchy::getVertexAt(size_t index) const
+{
+	assert(index < vertices.size());
+
+	return *vertices[index];
+}
+
+size_t ContractionHierarchy::getShortcutsCount() const
+{
+	return shortcutsCount;
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#ifndef __CONTRACTION_HIERARCHY_HEADER_INCLUDED__
+#define __CONTRACTION_HIERARCHY_HEADER_INCLUDED__
+
+#include "../../Graph/Vertex/Vertex.h"
+#include <cstdint>
+#include <vector>
+
+class StaticGraph;
+
+///
+/// A contraction hierarchy of a frozen graph.
+///
+/// The vertices are contracted one at a time, in the order of their edge
+/// difference: the number of shortcuts the contraction would add minus
+/// the number of edges it would remove, plus the number of already
+/// contracted neighbours to spread the contractions evenly. Contracting a
+/// vertex v adds a shortcut u -> w through v for every pair of edges
+/// u -> v -> w unless a witness search, which is bounded and does not go
+/// through v, finds a path from u to w which is at most as long.
+///
+/// The rank of a vertex is its position in that order. Every edge and
+/// shortcut is kept either at its start, if it leads upwards, or at its
+/// end, if it comes from above, so a query only climbs: forward from the
+/// source over the upward edges and backward from the target over the
+/// edges from above.
+///
+/// A hierarchy is saved and restored along with its graph in snapshots
+/// (see SnapshotFormat).
+///
+class ContractionHierarchy
+{
+	friend class SnapshotWriter;
+	friend class SnapshotReader;
+
+	struct HierarchyEdge
+	{
+		std::uint32_t vertexIndex;
+		std::uint32_t weight;
+		std::uint32_t middleIndex;
+	};
+
+	class Builder;
+
+	typedef std::vector<HierarchyEdge> EdgesArray;
+	typedef std::vector<size_t> OffsetsArray;
+	typedef std::vector<std::uint32_t> RanksArray;
+	typedef std::vector<const Vertex*> VerticesArray;
+
+public:
+	typedef std::vector<size_t> IndicesArray;
+
+public:
+	explicit ContractionHierarchy(const StaticGraph& graph);
+	ContractionHierarchy(const ContractionHierarchy&) = delete;
+	ContractionHierarchy& operator=(const ContractionHierarchy&) = delete;
+	~ContractionHierarchy() = default;
+
+	template <class Function>
+	void forEachUpwardEdgeLeaving(const Vertex& v, const Function& function) const;
+
+	template <class Function>
+	void forEachUpwardEdgeEntering(const Vertex& v, const Function& function) const;
+
+	void appendUnpackedEdge(size_t startIndex, size_t endIndex, IndicesArray& path) const;
+	const Vertex& getVertexAt(size_t index) const;
+	size_t getShortcutsCount() const;
+
+private:
+	static const std::uint32_t NO_MIDDLE = static_cast<std::uint32_t>(-1);
+
+private:
+	static size_t countShortcutsIn(const EdgesArray& edges);
+
+private:
+	ContractionHierarchy(const StaticGraph& graph,
+						 RanksArray&& ranks,
+						 OffsetsArray&& upwardOffsets,
+						 EdgesArray&& upwardEdges,
+						 OffsetsArray&& downwardOffsets,
+						 EdgesArray&& downwardEdges);
+
+	void collectVerticesOf(const StaticGraph& graph);
+	const HierarchyEdge& findEdge(size_t startIndex, size_t endIndex) const;
+
+	template <class Function>
+	void forEachEdgeOf(const Vertex& v,
+					   const EdgesArray& edges,
+					   const OffsetsArray& offsets,
+					   const Function& function) const;
+
+private:
+	VerticesArray vertices;
+	RanksArray ranks;
+	OffsetsArray upwardOffsets;
+	EdgesArray upwardEdges;
+	OffsetsArray downwardOffsets;
+	EdgesArray downwardEdges;
+	size_t shortcutsCount;
+};
+
+///
+/// Calls function with the vertex at the other end and the weight of every
+/// edge leaving v towards a vertex of a higher rank.
+///
+template <class Function>
+inline void ContractionHierarchy::forEachUpwardEdgeLeaving(const Vertex& v, const Function& function) const
+{
+	forEachEdgeOf(v, upwardEdges, upwardOffsets, function);
+}
+
+///
+/// Calls function with the vertex at the other end and the weight of every
+/// edge entering v from a vertex of a higher rank.
+///
+template <class Function>
+inline void ContractionHierarchy::forEachUpwardEdgeEntering(const Vertex& v, const Function& function) const
+{
+	forEachEdgeOf(v, downwardEdges, downwardOffsets, function);
+}
+
+template <class Function>
+void ContractionHierarchy::forEachEdgeOf(const Vertex& v,
+										 const EdgesArray& edges,
+										 const OffsetsArray& offsets,
+										 const Function& function) const
+{
+	size_t index = v.getIndex();
+
+	for (size_t i = offsets[index]; i < offsets[index + 1]; ++i)
+	{
+		function(*vertices[edges[i].vertexIndex], edges[i].weight);
+	}
+}
+
+#endif //__CONTRACTION_HIERARCHY_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef __DECORATED_VERTICES_HEADER_INCLUDED__
+#define __DECORATED_VERTICES_HEADER_INCLUDED__
+
+#include "../../Graph/Vertex/Vertex.h"
+#include <vector>
+#include <assert.h>
+
+///
+/// Decorated versions of the vertices of a graph, addressed by vertex index.
+///
+/// The storage is kept between searches and every search opens a new
+/// session by advancing a stamp, so nothing is cleared between searches.
+/// A decorated vertex is (re)initialised the first time it is accessed
+/// in the current session, which keeps the cost of a search proportional
+/// to the number of vertices it reaches.
+///
+template <class DecoratedVertex>
+class DecoratedVertices
+{
+	struct Entry
+	{
+		Entry() :
+			stamp(0)
+		{
+		}
+
+		DecoratedVertex decoratedVertex;
+		unsigned stamp;
+	};
+
+public:
+	DecoratedVertices() :
+		currentStamp(0)
+	{
+	}
+
+	DecoratedVertices(const DecoratedVertices&) = delete;
+	DecoratedVertices& operator=(const DecoratedVertices&) = delete;
+
+	void startNewSession(size_t verticesCount)
+	{
+		if (entries.size() < verticesCount)
+		{
+			entries.resize(verticesCount);
+		}
+
+		++currentStamp;
+
+		if (currentStamp == 0)
+		{
+			resetStamps();
+		}
+	}
+
+	DecoratedVertex& operator[](const Vertex& vertex)
+	{
+		assert(vertex.getIndex() < entries.size());
+
+		Entry& entry = entries[vertex.getIndex()];
+
+		if (entry.stamp != currentStamp)
+		{
+			entry.decoratedVertex = DecoratedVertex(&vertex);
+			entry.stamp = currentStamp;
+		}
+
+		return entry.decoratedVertex;
+	}
+
+private:
+	void resetStamps()
+	{
+		for (Entry& entry : entries)
+		{
+			entry.stamp = 0;
+		}
+
+		currentStamp = 1;
+	}
+
+private:
+	std::vector<Entry> entries;
+	unsigned currentStamp;
+};
+
+#endif //__DECORATED_VERTICES_HEADER_INCLUDED__
\ No newline at end of file
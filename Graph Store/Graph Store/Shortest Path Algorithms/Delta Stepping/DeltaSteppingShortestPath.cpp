@@ -0,0 +1,400 @@
+#include "DeltaSteppingShortestPath.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
+#include <algorithm>
+#include <assert.h>
+
+static ShortestPathAlgorithmRegistrator<DeltaSteppingShortestPath> registrator("delta-stepping");
+
+const std::uint32_t DeltaSteppingShortestPath::NO_PARENT;
+const std::uint64_t DeltaSteppingShortestPath::UNREACHED;
+
+DeltaSteppingShortestPath::DeltaSteppingShortestPath(const String& id) :
+	ShortestPathAlgorithm(id),
+	delta(DEFAULT_DELTA),
+	threadsCount(ThreadPool::getDefaultThreadsCount()),
+	labelsCapacity(0),
+	frontierStamp(0),
+	settledStamp(0),
+	isLastSearchFinished(true)
+{
+}
+
+void DeltaSteppingShortestPath::setDelta(unsigned delta)
+{
+	assert(delta > 0);
+
+	this->delta = delta;
+}
+
+///
+/// 0 stands for the number of hardware threads.
+///
+void DeltaSteppingShortestPath::setThreadsCount(size_t threadsCount)
+{
+	this->threadsCount = (threadsCount > 0) ? threadsCount : ThreadPool::getDefaultThreadsCount();
+}
+
+unsigned DeltaSteppingShortestPath::getDelta() const
+{
+	return delta;
+}
+
+size_t DeltaSteppingShortestPath::getThreadsCount() const
+{
+	return threadsCount;
+}
+
+///
+/// The threads are only started by the first search, not when the
+/// algorithm is registered, and again when their number changes.
+///
+ThreadPool& DeltaSteppingShortestPath::getThreadPool()
+{
+	if (threadPool == nullptr || threadPool->getThreadsCount() != threadsCount)
+	{
+		threadPool.reset();
+		threadPool.reset(new ThreadPool(threadsCount));
+	}
+
+	return *threadPool;
+}
+
+void DeltaSteppingShortestPath::initialise(const Graph& graph,
+										   const Vertex& source,
+										   const Vertex&)
+{
+	size_t verticesCount = graph.getVerticesCount();
+
+	decoratedVertices.startNewSession(verticesCount);
+	initialiseSource(decoratedVertices[source]);
+
+	resetLabels(verticesCount);
+
+	if (frontierStamps.size() < verticesCount)
+	{
+		frontierStamps.resize(verticesCount, 0);
+		settledStamps.resize(verticesCount, 0);
+	}
+
+	requestsOfThreads.resize(getThreadPool().getThreadsCount());
+
+	labels[source.getIndex()].store(pack(0, NO_PARENT), std::memory_order_relaxed);
+	markAsReached(source);
+	addToBucket(source);
+}
+
+///
+/// Only the labels of the vertices reached by the last search are reset,
+/// so a search which reaches a few vertices does not pay for the whole
+/// graph. A search interrupted by an exception may have changed labels it
+/// did not record, so all of them are reset after it.
+///
+void DeltaSteppingShortestPath::resetLabels(size_t verticesCount)
+{
+	if (labelsCapacity < verticesCount)
+	{
+		labels.reset();
+		labels.reset(new Label[verticesCount]);
+		labelsCapacity = verticesCount;
+		verticesByIndex.resize(verticesCount);
+		resetAllLabels();
+	}
+	else if (isLastSearchFinished)
+	{
+		for (size_t index : reachedIndices)
+		{
+			labels[index].store(UNREACHED, std::memory_order_relaxed);
+			verticesByIndex[index] = nullptr;
+		}
+	}
+	else
+	{
+		resetAllLabels();
+	}
+
+	reachedIndices.clear();
+	isLastSearchFinished = false;
+}
+
+void DeltaSteppingShortestPath::resetAllLabels()
+{
+	for (size_t i = 0; i < labelsCapacity; ++i)
+	{
+		labels[i].store(UNREACHED, std::memory_order_relaxed);
+	}
+
+	std::fill(verticesByIndex.begin(), verticesByIndex.end(), nullptr);
+}
+
+void DeltaSteppingShortestPath::markAsReached(const Vertex& v)
+{
+	size_t index = v.getIndex();
+
+	if (verticesByIndex[index] == nullptr)
+	{
+		verticesByIndex[index] = &v;
+		reachedIndices.push_back(index);
+	}
+}
+
+DeltaSteppingShortestPath::DecoratedVertex&
+DeltaSteppingShortestPath::getDecoratedVersionOf(const Vertex& v)
+{
+	return decoratedVertices[v];
+}
+
+void DeltaSteppingShortestPath::execute(const Graph& graph,
+										const Vertex&,
+										const Vertex& target)
+{
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		searchIn(concreteGraph, target);
+	});
+
+	collectPathTo(target);
+	isLastSearchFinished = true;
+}
+
+template <class ConcreteGraph>
+void DeltaSteppingShortestPath::searchIn(const ConcreteGraph& graph, const Vertex& target)
+{
+	while (!buckets.empty())
+	{
+		std::uint64_t bucketIndex = buckets.begin()->first;
+
+		if (isDetermined(target, bucketIndex))
+		{
+			return;
+		}
+
+		emptyBucket(graph, bucketIndex);
+	}
+}
+
+///
+/// Once the buckets below bucketIndex are empty, so are the distances
+/// lower than the start of that bucket final.
+///
+bool DeltaSteppingShortestPath::isDetermined(const Vertex& v, std::uint64_t bucketIndex) const
+{
+	return labels[v.getIndex()].load(std::memory_order_relaxed) != UNREACHED
+		   && getDistanceOf(v) < bucketIndex * delta;
+}
+
+///
+/// The light edges may refill the bucket, so they are relaxed from the
+/// vertices which (re)entered it until it stays empty. The heavy ones lead
+/// past it and are relaxed once, from the final distances.
+///
+template <class ConcreteGraph>
+void DeltaSteppingShortestPath::emptyBucket(const ConcreteGraph& graph, std::uint64_t bucketIndex)
+{
+	advanceStamp(settledStamp, settledStamps);
+	settled.clear();
+
+	while (!buckets.empty() && buckets.begin()->first == bucketIndex)
+	{
+		takeFrontierFrom(buckets.begin());
+		addFrontierToSettled();
+
+		relaxEdgesLeaving(frontier, graph, true);
+		moveRequestsToBuckets();
+	}
+
+	relaxEdgesLeaving(settled, graph, false);
+	moveRequestsToBuckets();
+}
+
+///
+/// A vertex may have been put in the bucket more than once, or have moved
+/// to a lower one since, so only its current entries are kept, once each.
+///
+void DeltaSteppingShortestPath::takeFrontierFrom(Buckets::iterator bucket)
+{
+	advanceStamp(frontierStamp, frontierStamps);
+	frontier.clear();
+
+	for (const Vertex* v : bucket->second)
+	{
+		size_t index = v->getIndex();
+
+		if (frontierStamps[index] != frontierStamp && getDistanceOf(*v) / delta == bucket->first)
+		{
+			frontierStamps[index] = frontierStamp;
+			frontier.push_back(v);
+		}
+	}
+
+	buckets.erase(bucket);
+}
+
+void DeltaSteppingShortestPath::addFrontierToSettled()
+{
+	for (const Vertex* v : frontier)
+	{
+		if (settledStamps[v->getIndex()] != settledStamp)
+		{
+			settledStamps[v->getIndex()] = settledStamp;
+			settled.push_back(v);
+		}
+	}
+}
+
+void DeltaSteppingShortestPath::advanceStamp(unsigned& stamp, std::vector<unsigned>& stamps)
+{
+	++stamp;
+
+	if (stamp == 0)
+	{
+		std::fill(stamps.begin(), stamps.end(), 0);
+		stamp = 1;
+	}
+}
+
+///
+/// The threads take the vertices in chunks and collect the vertices whose
+/// distances they improved, which are put in buckets after all of them
+/// are done.
+///
+template <class ConcreteGraph>
+void DeltaSteppingShortestPath::relaxEdgesLeaving(const VerticesArray& vertices,
+												  const ConcreteGraph& graph,
+												  bool relaxLightEdges)
+{
+	std::atomic<size_t> nextChunk(0);
+
+	getThreadPool().runOnEveryThread([&](size_t threadIndex)
+	{
+		VerticesArray& requests = requestsOfThreads[threadIndex];
+
+		for (size_t first = nextChunk.fetch_add(VERTICES_PER_CHUNK);
+			 first < vertices.size();
+			 first = nextChunk.fetch_add(VERTICES_PER_CHUNK))
+		{
+			size_t last = std::min(first + VERTICES_PER_CHUNK, vertices.size());
+
+			for (size_t i = first; i < last; ++i)
+			{
+				const Vertex& start = *vertices[i];
+				std::uint64_t distance = getDistanceOf(start);
+
+				graph.forEachEdgeLeaving(start, [&](const Edge& e)
+				{
+					if ((e.getWeight() <= delta) == relaxLightEdges
+						&& tryToImprove(e.getVertex(), distance + e.getWeight(), start.getIndex()))
+					{
+						requests.push_back(&e.getVertex());
+					}
+				});
+			}
+		}
+	});
+}
+
+///
+/// Lowers the distance of v with an atomic compare-and-swap, together
+/// with its parent, unless some thread has already found a shorter one.
+///
+bool DeltaSteppingShortestPath::tryToImprove(const Vertex& v,
+											 std::uint64_t distance,
+											 size_t parentIndex)
+{
+	Label& label = labels[v.getIndex()];
+	std::uint64_t currentLabel = label.load(std::memory_order_relaxed);
+	std::uint64_t improvedLabel = pack(distance, parentIndex);
+
+	while (distance < getDistanceIn(currentLabel))
+	{
+		if (label.compare_exchange_weak(currentLabel, improvedLabel, std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void DeltaSteppingShortestPath::moveRequestsToBuckets()
+{
+	for (VerticesArray& requests : requestsOfThreads)
+	{
+		for (const Vertex* v : requests)
+		{
+			markAsReached(*v);
+			addToBucket(*v);
+		}
+
+		requests.clear();
+	}
+}
+
+void DeltaSteppingShortestPath::addToBucket(const Vertex& v)
+{
+	buckets[getDistanceOf(v) / delta].push_back(&v);
+}
+
+std::uint64_t DeltaSteppingShortestPath::getDistanceOf(const Vertex& v) const
+{
+	return getDistanceIn(labels[v.getIndex()].load(std::memory_order_relaxed));
+}
+
+///
+/// The distance takes the upper half of a label, so comparing labels
+/// compares distances first. Distances do not exceed 32 bits anyway.
+///
+std::uint64_t DeltaSteppingShortestPath::pack(std::uint64_t distance, size_t parentIndex)
+{
+	return (distance << 32) | static_cast<std::uint32_t>(parentIndex);
+}
+
+std::uint64_t DeltaSteppingShortestPath::getDistanceIn(std::uint64_t label)
+{
+	return label >> 32;
+}
+
+size_t DeltaSteppingShortestPath::getParentIndexIn(std::uint64_t label)
+{
+	return static_cast<std::uint32_t>(label);
+}
+
+///
+/// Turns the parent indices on the path to the target into decorated
+/// vertices, so the path is collected as for the other algorithms. A label
+/// is only replaced by a shorter one, so the parents can not form a cycle.
+///
+void DeltaSteppingShortestPath::collectPathTo(const Vertex& target)
+{
+	std::uint64_t label = labels[target.getIndex()].load(std::memory_order_relaxed);
+
+	if (label == UNREACHED)
+	{
+		return;
+	}
+
+	DecoratedVertex* current = &getDecoratedVersionOf(target);
+	current->distanceToSource = static_cast<unsigned>(getDistanceIn(label));
+
+	while (getParentIndexIn(label) != NO_PARENT)
+	{
+		size_t parentIndex = getParentIndexIn(label);
+		DecoratedVertex& parent = getDecoratedVersionOf(*verticesByIndex[parentIndex]);
+
+		current->parent = &parent;
+		current = &parent;
+		label = labels[parentIndex].load(std::memory_order_relaxed);
+	}
+}
+
+void DeltaSteppingShortestPath::cleanUp()
+{
+	buckets.clear();
+	frontier.clear();
+	settled.clear();
+
+	for (VerticesArray& requests : requestsOfThreads)
+	{
+		requests.clear();
+	}
+}
\ No newline at end of file
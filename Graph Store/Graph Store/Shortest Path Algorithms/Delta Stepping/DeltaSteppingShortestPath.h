@@ -0,0 +1,100 @@
+#ifndef __DELTA_STEPPING_SHORTEST_PATH_HEADER_INCLUDED__
+#define __DELTA_STEPPING_SHORTEST_PATH_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../Decorated Vertices/DecoratedVertices.h"
+#include "../../Thread Pool/ThreadPool.h"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+///
+/// Delta-stepping (Meyer and Sanders): the vertices are kept in buckets of
+/// width delta by their tentative distance and the lowest bucket is emptied
+/// as a whole. The edges not heavier than delta, which may lead back into the
+/// same bucket, are relaxed from the bucket until it stays empty, and the
+/// heavier ones only once, from every vertex which was in it.
+///
+/// The vertices of a bucket are relaxed in parallel. The tentative distance
+/// and the parent of a vertex are packed in a single 64-bit word and improved
+/// together with compare-and-swap, so the parents always form a tree. The
+/// search stops as soon as every bucket below the target is empty.
+///
+class DeltaSteppingShortestPath : public ShortestPathAlgorithm
+{
+	typedef std::vector<const Vertex*> VerticesArray;
+	typedef std::map<std::uint64_t, VerticesArray> Buckets;
+	typedef std::atomic<std::uint64_t> Label;
+
+public:
+	explicit DeltaSteppingShortestPath(const String& id);
+	DeltaSteppingShortestPath(const DeltaSteppingShortestPath&) = delete;
+	DeltaSteppingShortestPath& operator=(const DeltaSteppingShortestPath&) = delete;
+
+	void setDelta(unsigned delta);
+	void setThreadsCount(size_t threadsCount);
+	unsigned getDelta() const;
+	size_t getThreadsCount() const;
+
+private:
+	static const unsigned DEFAULT_DELTA = 64;
+	static const size_t VERTICES_PER_CHUNK = 64;
+	static const std::uint32_t NO_PARENT = static_cast<std::uint32_t>(-1);
+	static const std::uint64_t UNREACHED = static_cast<std::uint64_t>(-1);
+
+private:
+	static std::uint64_t pack(std::uint64_t distance, size_t parentIndex);
+	static std::uint64_t getDistanceIn(std::uint64_t label);
+	static size_t getParentIndexIn(std::uint64_t label);
+	static void advanceStamp(unsigned& stamp, std::vector<unsigned>& stamps);
+
+private:
+	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void cleanUp() override;
+	virtual DecoratedVertex& getDecoratedVersionOf(const Vertex& vertex) override;
+	void resetLabels(size_t verticesCount);
+	void resetAllLabels();
+	void markAsReached(const Vertex& v);
+	void addToBucket(const Vertex& v);
+	bool isDetermined(const Vertex& v, std::uint64_t bucketIndex) const;
+	bool tryToImprove(const Vertex& v, std::uint64_t distance, size_t parentIndex);
+	std::uint64_t getDistanceOf(const Vertex& v) const;
+	void takeFrontierFrom(Buckets::iterator bucket);
+	void addFrontierToSettled();
+	void moveRequestsToBuckets();
+	void collectPathTo(const Vertex& target);
+	ThreadPool& getThreadPool();
+
+	template <class ConcreteGraph>
+	void searchIn(const ConcreteGraph& graph, const Vertex& target);
+
+	template <class ConcreteGraph>
+	void emptyBucket(const ConcreteGraph& graph, std::uint64_t bucketIndex);
+
+	template <class ConcreteGraph>
+	void relaxEdgesLeaving(const VerticesArray& vertices, const ConcreteGraph& graph, bool relaxLightEdges);
+
+private:
+	unsigned delta;
+	size_t threadsCount;
+	std::unique_ptr<ThreadPool> threadPool;
+	std::unique_ptr<Label[]> labels;
+	size_t labelsCapacity;
+	VerticesArray verticesByIndex;
+	std::vector<size_t> reachedIndices;
+	std::vector<unsigned> frontierStamps;
+	std::vector<unsigned> settledStamps;
+	unsigned frontierStamp;
+	unsigned settledStamp;
+	bool isLastSearchFinished;
+	std::vector<VerticesArray> requestsOfThreads;
+	Buckets buckets;
+	VerticesArray frontier;
+	VerticesArray settled;
+	DecoratedVertices<DecoratedVertex> decoratedVertices;
+};
+
+#endif //__DELTA_STEPPING_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
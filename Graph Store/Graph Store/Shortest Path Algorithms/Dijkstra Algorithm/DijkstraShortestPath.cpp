@@ -1,5 +1,5 @@
 #include "DijkstraShortestPath.h"
-#include "../../Graph/Abstract class/Graph.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
 #include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
 
 static ShortestPathAlgorithmRegistrator<DijkstraShortestPath> registrator("dijkstra");
@@ -14,39 +14,41 @@ void DijkstraShortestPath::initialise(const Graph& graph,
 									  const Vertex& target)
 {
 	decorateVerticesOf(graph);
-	initialiseSource(getDecoratedVersionOf(source));
-	gatherDecoratedVerticesWithUndeterminedEstimate();
+	addSourceToUndeterminedEstimateVertices(source);
 }
 
 void DijkstraShortestPath::decorateVerticesOf(const Graph& graph)
 {
-	decoratedVertices.reserve(graph.getVerticesCount());
-
-	ShortestPathAlgorithm::decorateVerticesOf(graph);
-}
-
-void DijkstraShortestPath::addDecoratedVersionOf(const Vertex& v)
-{
-	decoratedVertices.emplace(v.getID(), v);
+	decoratedVertices.startNewSession(graph.getVerticesCount());
 }
 
 DijkstraShortestPath::DijkstraVertex&
 DijkstraShortestPath::getDecoratedVersionOf(const Vertex& v)
 {
-	return decoratedVertices[v.getID()];
+	return decoratedVertices[v];
 }
 
-void DijkstraShortestPath::gatherDecoratedVerticesWithUndeterminedEstimate()
+void DijkstraShortestPath::addSourceToUndeterminedEstimateVertices(const Vertex& source)
 {
-	HashIterator iterator = decoratedVertices.begin();
+	DijkstraVertex& decoratedSource = getDecoratedVersionOf(source);
 
-	undeterminedEstimateVertices =
-		PriorityQueue(iterator, decoratedVertices.size());
+	initialiseSource(decoratedSource);
+	undeterminedEstimateVertices.add(&decoratedSource);
 }
 
 void DijkstraShortestPath::execute(const Graph& graph,
 								   const Vertex& source,
 								   const Vertex& target)
+{
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		searchForShortestPathTo(target, concreteGraph);
+	});
+}
+
+template <class ConcreteGraph>
+void DijkstraShortestPath::searchForShortestPathTo(const Vertex& target,
+												   const ConcreteGraph& graph)
 {
 	DijkstraVertex* v;
 
@@ -54,7 +56,7 @@ void DijkstraShortestPath::execute(const Graph& graph,
 	{
 		v = undeterminedEstimateVertices.extractOptimal();
 
-		if (v->originalVertex == target)
+		if (v->originalVertex == &target)
 		{
 			return;
 		}
@@ -63,13 +65,11 @@ void DijkstraShortestPath::execute(const Graph& graph,
 	}
 }
 
+template <class ConcreteGraph>
 void DijkstraShortestPath::relaxEdgesLeaving(const DijkstraVertex& start,
-											 const Graph& graph)
+											 const ConcreteGraph& graph)
 {
-	Graph::EdgesConstIterator iterator =
-		graph.getConstIteratorOfEdgesLeaving(start.originalVertex);
-
-	forEach(*iterator, [&](const Edge& e)
+	graph.forEachEdgeLeaving(*start.originalVertex, [&](const Edge& e)
 	{
 		DijkstraVertex& end = getDecoratedVersionOf(e.getVertex());
 
@@ -85,7 +85,18 @@ void DijkstraShortestPath::relaxEdge(const DijkstraVertex& start,
 
 	if (distanceThroughStart < end.distanceToSource)
 	{
-		undeterminedEstimateVertices.optimiseKey(end.handle, distanceThroughStart);
+		//Only the source has no parent once reached and it can not be improved,
+		//so a vertex without a parent is being discovered right now.
+		if (end.parent == nullptr)
+		{
+			end.distanceToSource = distanceThroughStart;
+			undeterminedEstimateVertices.add(&end);
+		}
+		else
+		{
+			undeterminedEstimateVertices.optimiseKey(end.handle, distanceThroughStart);
+		}
+
 		end.parent = &start;
 	}
 }
@@ -93,5 +104,4 @@ void DijkstraShortestPath::relaxEdge(const DijkstraVertex& start,
 void DijkstraShortestPath::cleanUp()
 {
 	undeterminedEstimateVertices.empty();
-	decoratedVertices.clear();
 }
@@ -2,15 +2,14 @@
 #define __DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
 
 #include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../Decorated Vertices/DecoratedVertices.h"
 #include "../../Priority Queue/PriorityQueue.h"
-#include "../../Hash/Hash Function/HashFunctionStringSpecialization.h"
-#include <unordered_map>
 
 class DijkstraShortestPath : public ShortestPathAlgorithm
 {
 	struct DijkstraVertex : public DecoratedVertex
 	{
-		DijkstraVertex(const Vertex& originalVertex) :
+		DijkstraVertex(const Vertex* originalVertex = nullptr) :
 			DecoratedVertex(originalVertex)
 		{
 		}
@@ -21,52 +20,31 @@ class DijkstraShortestPath : public ShortestPathAlgorithm
 	class KeyAccessor
 	{
 	public:
-		const Distance& getKeyOf(const DijkstraVertex& v) const
+		const Distance& getKeyOf(const DijkstraVertex* v) const
 		{
-			return v.distanceToSource;
+			return v->distanceToSource;
 		}
 
-		void setKeyOfWith(DijkstraVertex& v, const Distance& d) const
+		void setKeyOfWith(DijkstraVertex* v, const Distance& d) const
 		{
-			v.distanceToSource = d;
+			v->distanceToSource = d;
 		}
 	};
 
 	class HandleUpdator
 	{
 	public:
-		void operator()(DijkstraVertex& v, const PriorityQueueHandle& h) const
+		void operator()(DijkstraVertex* v, const PriorityQueueHandle& h) const
 		{
-			v.handle = h;
+			v->handle = h;
 		}
 	};
 
-	typedef PriorityQueue<DijkstraVertex*, Less, Distance, KeyAccessor, HandleUpdator> PriorityQueue;
-	typedef std::unordered_map<String, DijkstraVertex, HashFunction<String>> Hash;
-
-	class HashIterator
-	{
-	public:
-		HashIterator(const Hash::iterator& iterator) :
-			iterator(iterator)
-		{
-		}
-
-		HashIterator& operator++()
-		{
-			++iterator;
-
-			return *this;
-		}
-
-		DijkstraVertex* operator*() const
-		{
-			return &(iterator->second);
-		}
-
-	private:
-		Hash::iterator iterator;
-	};
+	///
+	/// A 4-ary heap: a search optimises keys far more often than it extracts
+	/// and the shallower heap sifts them up in fewer steps.
+	///
+	typedef PriorityQueue<DijkstraVertex*, Less, Distance, KeyAccessor, HandleUpdator, 4> PriorityQueue;
 
 public:
 	explicit DijkstraShortestPath(const String& id);
@@ -77,16 +55,20 @@ private:
 	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
 	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
 	virtual void cleanUp() override;
-	virtual void addDecoratedVersionOf(const Vertex& vertex) override;
 	virtual DijkstraVertex& getDecoratedVersionOf(const Vertex& vertex) override;
 	void decorateVerticesOf(const Graph& graph);
-	void gatherDecoratedVerticesWithUndeterminedEstimate();
-	void relaxEdgesLeaving(const DijkstraVertex& vertex, const Graph& graph);
+	void addSourceToUndeterminedEstimateVertices(const Vertex& source);
 	void relaxEdge(const DijkstraVertex& start, DijkstraVertex& end, unsigned weight);
 
+	template <class ConcreteGraph>
+	void searchForShortestPathTo(const Vertex& target, const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void relaxEdgesLeaving(const DijkstraVertex& vertex, const ConcreteGraph& graph);
+
 private:
 	PriorityQueue undeterminedEstimateVertices;
-	Hash decoratedVertices;
+	DecoratedVertices<DijkstraVertex> decoratedVertices;
 };
 
 #endif //__DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
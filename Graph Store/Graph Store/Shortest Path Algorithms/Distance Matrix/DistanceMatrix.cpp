@@ -0,0 +1,116 @@
+#include "DistanceMatrix.h"
+#include "../Shortest Path Tree/ShortestPathTree.h"
+#include "../../Graph/Vertex/Vertex.h"
+#include "../../Thread Pool/ThreadPool.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+DistanceMatrix::DistanceMatrix(const VerticesArray& sources, const VerticesArray& targets) :
+	sources(sources),
+	targets(targets)
+{
+}
+
+///
+/// The listener is called by the thread which has just computed a row,
+/// never by two threads at once.
+///
+void DistanceMatrix::compute(const Graph& graph, size_t threadsCount, const ProgressListener& listener)
+{
+	assert(threadsCount > 0);
+
+	distances.assign(sources.size() * targets.size(), ShortestPathTree::UNREACHED);
+
+	if (targets.empty())
+	{
+		return;
+	}
+
+	std::vector<ShortestPathTree> trees(threadsCount);
+	std::atomic<size_t> nextRow(0);
+	std::mutex progressMutex;
+	size_t computedRowsCount = 0;
+	ThreadPool pool(threadsCount);
+
+	pool.runOnEveryThread([&](size_t threadIndex)
+	{
+		for (size_t row = nextRow++; row < sources.size(); row = nextRow++)
+		{
+			computeRow(graph, row, trees[threadIndex]);
+
+			std::lock_guard<std::mutex> lock(progressMutex);
+			++computedRowsCount;
+
+			if (listener)
+			{
+				listener(computedRowsCount);
+			}
+		}
+	});
+}
+
+void DistanceMatrix::computeRow(const Graph& graph, size_t row, ShortestPathTree& tree)
+{
+	tree.grow(graph, *sources[row], targets);
+
+	const ShortestPathTree::DistancesArray& distancesFromSource = tree.getDistances();
+	unsigned* rowDistances = &distances[row * targets.size()];
+
+	for (size_t column = 0; column < targets.size(); ++column)
+	{
+		rowDistances[column] = distancesFromSource[targets[column]->getIndex()];
+	}
+}
+
+void DistanceMatrix::writeAsBinary(std::ostream& out) const
+{
+	std::uint32_t dimensions[] = { static_cast<std::uint32_t>(getRowsCount()),
+								   static_cast<std::uint32_t>(getColumnsCount()) };
+
+	static_assert(sizeof(unsigned) == sizeof(std::uint32_t), "The distances are written as they are kept!");
+
+	out.write(reinterpret_cast<const char*>(dimensions), sizeof(dimensions));
+	out.write(reinterpret_cast<const char*>(distances.data()), distances.size() * sizeof(unsigned));
+}
+
+void DistanceMatrix::writeAsCSV(std::ostream& out) const
+{
+	for (const Vertex* target : targets)
+	{
+		out << ',' << target->getID();
+	}
+
+	out << '\n';
+
+	for (size_t row = 0; row < getRowsCount(); ++row)
+	{
+		out << sources[row]->getID();
+
+		for (size_t column = 0; column < getColumnsCount(); ++column)
+		{
+			out << ',' << getDistance(row, column);
+		}
+
+		out << '\n';
+	}
+}
+
+Distance DistanceMatrix::getDistance(size_t row, size_t column) const
+{
+	assert(row < getRowsCount() && column < getColumnsCount());
+
+	unsigned distance = distances[row * getColumnsCount() + column];
+
+	return (distance != ShortestPathTree::UNREACHED) ? Distance(distance) : Distance::getInfinity();
+}
+
+size_t DistanceMatrix::getRowsCount() const
+{
+	return sources.size();
+}
+
+size_t DistanceMatrix::getColumnsCount() const
+{
+	return targets.size();
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef __DISTANCE_MATRIX_HEADER_INCLUDED__
+#define __DISTANCE_MATRIX_HEADER_INCLUDED__
+
+#include "../../Distance/Distance.h"
+#include <functional>
+#include <ostream>
+#include <vector>
+
+class Graph;
+class Vertex;
+class ShortestPathTree;
+
+///
+/// The distances from every source to every target, one row per source.
+///
+/// Each row comes from a single shortest path tree grown from its source
+/// until all of the targets are settled. The rows are handed out to the
+/// threads of a pool one at a time, and each thread reuses its own tree.
+///
+/// In binary form the matrix is the number of rows and the number of
+/// columns followed by the distances row by row, all of them 32-bit
+/// unsigned integers in native byte order, with 0xFFFFFFFF for unreachable
+/// targets. In CSV form the first row holds the identifiers of the targets
+/// and every other row starts with the identifier of its source.
+///
+class DistanceMatrix
+{
+public:
+	typedef std::vector<const Vertex*> VerticesArray;
+	typedef std::function<void(size_t computedRowsCount)> ProgressListener;
+
+public:
+	DistanceMatrix(const VerticesArray& sources, const VerticesArray& targets);
+	DistanceMatrix(const DistanceMatrix&) = default;
+	DistanceMatrix& operator=(const DistanceMatrix&) = default;
+	DistanceMatrix(DistanceMatrix&&) = default;
+	DistanceMatrix& operator=(DistanceMatrix&&) = default;
+	~DistanceMatrix() = default;
+
+	void compute(const Graph& graph, size_t threadsCount, const ProgressListener& listener = ProgressListener());
+	void writeAsBinary(std::ostream& out) const;
+	void writeAsCSV(std::ostream& out) const;
+
+	Distance getDistance(size_t row, size_t column) const;
+	size_t getRowsCount() const;
+	size_t getColumnsCount() const;
+
+private:
+	void computeRow(const Graph& graph, size_t row, ShortestPathTree& tree);
+
+private:
+	VerticesArray sources;
+	VerticesArray targets;
+	std::vector<unsigned> distances;
+};
+
+#endif //__DISTANCE_MATRIX_HEADER_INCLUDED__
\ No newline at end of file
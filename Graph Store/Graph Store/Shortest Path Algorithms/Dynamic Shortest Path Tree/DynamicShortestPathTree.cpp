@@ -0,0 +1,216 @@
+#include "DynamicShortestPathTree.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+
+const unsigned DynamicShortestPathTree::UNREACHED;
+
+DynamicShortestPathTree::DynamicShortestPathTree(const Graph& graph, const Vertex& source) :
+	source(source)
+{
+	rebuild(graph);
+}
+
+void DynamicShortestPathTree::rebuild(const Graph& graph)
+{
+	distances.assign(graph.getVerticesCount(), UNREACHED);
+	parents.assign(graph.getVerticesCount(), nullptr);
+
+	Queue queue;
+	distances[source.getIndex()] = 0;
+	queue.add(QueueEntry(&source, 0));
+
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		settleFrom(concreteGraph, queue);
+	});
+}
+
+///
+/// The vertices added to the graph since the tree was last fitted are not
+/// reached yet.
+///
+void DynamicShortestPathTree::fitTo(const Graph& graph)
+{
+	distances.resize(graph.getVerticesCount(), UNREACHED);
+	parents.resize(graph.getVerticesCount(), nullptr);
+}
+
+///
+/// Only the vertices to which the new edge gives a shorter path are
+/// visited: the search starts from its end and stops at the vertices whose
+/// distances it does not lower.
+///
+void DynamicShortestPathTree::repairAfterAdding(const Graph& graph,
+												const Vertex& start,
+												const Vertex& end,
+												unsigned weight)
+{
+	fitTo(graph);
+
+	if (!isReached(start))
+	{
+		return;
+	}
+
+	unsigned distanceThroughStart = distances[start.getIndex()] + weight;
+
+	if (distanceThroughStart < distances[end.getIndex()])
+	{
+		Queue queue;
+		distances[end.getIndex()] = distanceThroughStart;
+		parents[end.getIndex()] = &start;
+		queue.add(QueueEntry(&end, distanceThroughStart));
+
+		dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+		{
+			settleFrom(concreteGraph, queue);
+		});
+	}
+}
+
+///
+/// Removing an edge can only make distances longer, and only those of the
+/// vertices below it in the tree. The distances of all other vertices stay
+/// valid, so each vertex of the subtree starts from its best edge entering
+/// it from outside and the subtree is settled again.
+///
+void DynamicShortestPathTree::repairAfterRemoving(const Graph& graph, const Vertex& start, const Vertex& end)
+{
+	fitTo(graph);
+
+	if (parents[end.getIndex()] != &start)
+	{
+		return;
+	}
+
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		VerticesArray subtree;
+		cutOffSubtreeOf(concreteGraph, end, subtree);
+
+		Queue queue;
+		reattach(concreteGraph, subtree, queue);
+		settleFrom(concreteGraph, queue);
+	});
+}
+
+///
+/// The children of a vertex in the tree are among the ends of the edges
+/// leaving it, so the subtree is collected by walking those edges and
+/// keeping the ends whose parent is the vertex walked from.
+///
+template <class ConcreteGraph>
+void DynamicShortestPathTree::cutOffSubtreeOf(const ConcreteGraph& graph, const Vertex& root, VerticesArray& subtree)
+{
+	subtree.push_back(&root);
+
+	for (size_t i = 0; i < subtree.size(); ++i)
+	{
+		const Vertex* parent = subtree[i];
+
+		graph.forEachEdgeLeaving(*parent, [&](const Edge& e)
+		{
+			if (parents[e.getVertex().getIndex()] == parent)
+			{
+				subtree.push_back(&e.getVertex());
+			}
+		});
+	}
+
+	for (const Vertex* v : subtree)
+	{
+		distances[v->getIndex()] = UNREACHED;
+		parents[v->getIndex()] = nullptr;
+	}
+}
+
+template <class ConcreteGraph>
+void DynamicShortestPathTree::reattach(const ConcreteGraph& graph, const VerticesArray& subtree, Queue& queue)
+{
+	for (const Vertex* v : subtree)
+	{
+		size_t index = v->getIndex();
+
+		graph.forEachEdgeEntering(*v, [&](const Edge& e)
+		{
+			const Vertex& start = e.getVertex();
+
+			if (isReached(start))
+			{
+				unsigned distanceThroughStart = distances[start.getIndex()] + e.getWeight();
+
+				if (distanceThroughStart < distances[index])
+				{
+					distances[index] = distanceThroughStart;
+					parents[index] = &start;
+				}
+			}
+		});
+
+		if (isReached(*v))
+		{
+			queue.add(QueueEntry(v, distances[index]));
+		}
+	}
+}
+
+///
+/// Dijkstra's algorithm from the vertices in the queue, with the labels
+/// of the tree as its tentative distances. Stale entries are skipped when
+/// extracted, as in ShortestPathTree.
+///
+template <class ConcreteGraph>
+void DynamicShortestPathTree::settleFrom(const ConcreteGraph& graph, Queue& queue)
+{
+	while (!queue.isEmpty())
+	{
+		QueueEntry entry = queue.extractOptimal();
+
+		if (entry.distance != distances[entry.vertex->getIndex()])
+		{
+			continue;
+		}
+
+		graph.forEachEdgeLeaving(*entry.vertex, [&](const Edge& e)
+		{
+			unsigned distanceThroughVertex = entry.distance + e.getWeight();
+			size_t endIndex = e.getVertex().getIndex();
+
+			if (distanceThroughVertex < distances[endIndex])
+			{
+				distances[endIndex] = distanceThroughVertex;
+				parents[endIndex] = entry.vertex;
+				queue.add(QueueEntry(&e.getVertex(), distanceThroughVertex));
+			}
+		});
+	}
+}
+
+const Vertex& DynamicShortestPathTree::getSource() const
+{
+	return source;
+}
+
+bool DynamicShortestPathTree::isReached(const Vertex& v) const
+{
+	return v.getIndex() < distances.size() && distances[v.getIndex()] != UNREACHED;
+}
+
+Distance DynamicShortestPathTree::getDistanceTo(const Vertex& v) const
+{
+	return isReached(v) ? Distance(distances[v.getIndex()]) : Distance::getInfinity();
+}
+
+ShortestPathAlgorithm::Path DynamicShortestPathTree::getPathTo(const Vertex& target) const
+{
+	std::forward_list<String> identifiers;
+
+	if (isReached(target))
+	{
+		for (const Vertex* v = &target; v != nullptr; v = parents[v->getIndex()])
+		{
+			identifiers.push_front(v->getID());
+		}
+	}
+
+	return ShortestPathAlgorithm::Path(std::move(identifiers), getDistanceTo(target));
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef __DYNAMIC_SHORTEST_PATH_TREE_HEADER_INCLUDED__
+#define __DYNAMIC_SHORTEST_PATH_TREE_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../../Priority Queue/PriorityQueue.h"
+#include <vector>
+
+///
+/// A shortest path tree of every vertex reachable from a source, which is
+/// kept up to date as edges are added and removed, in the manner of
+/// Ramalingam and Reps: only the vertices whose distances change are
+/// visited.
+///
+/// After an edge is added, the distances which it shortens are lowered by
+/// Dijkstra's algorithm started from its end. After a tree edge is removed,
+/// the subtree below it is cut off, each of its vertices is reattached
+/// through its best edge from outside the subtree, and Dijkstra's algorithm
+/// settles the subtree again from there. Removing any other edge changes
+/// nothing.
+///
+/// Vertices added to the graph later are unreached until an edge reaches
+/// them. Removing a vertex renumbers the others, so the tree is then built
+/// again.
+///
+class DynamicShortestPathTree
+{
+	typedef std::vector<unsigned> DistancesArray;
+	typedef std::vector<const Vertex*> VerticesArray;
+
+	struct QueueEntry
+	{
+		QueueEntry(const Vertex* vertex = nullptr, unsigned distance = 0) :
+			vertex(vertex),
+			distance(distance)
+		{
+		}
+
+		bool operator<(const QueueEntry& rhs) const
+		{
+			return distance < rhs.distance;
+		}
+
+		const Vertex* vertex;
+		unsigned distance;
+	};
+
+	typedef PriorityQueue<QueueEntry, Less, QueueEntry, IdentityKeyAccessor, EmptyMethodFunctor, 4> Queue;
+
+public:
+	DynamicShortestPathTree(const Graph& graph, const Vertex& source);
+	DynamicShortestPathTree(const DynamicShortestPathTree&) = delete;
+	DynamicShortestPathTree& operator=(const DynamicShortestPathTree&) = delete;
+	~DynamicShortestPathTree() = default;
+
+	void repairAfterAdding(const Graph& graph, const Vertex& start, const Vertex& end, unsigned weight);
+	void repairAfterRemoving(const Graph& graph, const Vertex& start, const Vertex& end);
+	void rebuild(const Graph& graph);
+
+	const Vertex& getSource() const;
+	bool isReached(const Vertex& v) const;
+	Distance getDistanceTo(const Vertex& v) const;
+	ShortestPathAlgorithm::Path getPathTo(const Vertex& target) const;
+
+private:
+	static const unsigned UNREACHED = static_cast<unsigned>(-1);
+
+private:
+	template <class ConcreteGraph>
+	void cutOffSubtreeOf(const ConcreteGraph& graph, const Vertex& root, VerticesArray& subtree);
+
+	template <class ConcreteGraph>
+	void reattach(const ConcreteGraph& graph, const VerticesArray& subtree, Queue& queue);
+
+	template <class ConcreteGraph>
+	void settleFrom(const ConcreteGraph& graph, Queue& queue);
+
+	void fitTo(const Graph& graph);
+
+private:
+	const Vertex& source;
+	DistancesArray distances;
+	VerticesArray parents;
+};
+
+#endif //__DYNAMIC_SHORTEST_PATH_TREE_HEADER_INCLUDED__
\ No newline at end of file
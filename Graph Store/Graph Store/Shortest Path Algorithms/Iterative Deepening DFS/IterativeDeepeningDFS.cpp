@@ -1,5 +1,5 @@
 #include "IterativeDeepeningDFS.h"
-#include "../../Graph/Abstract class/Graph.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
 #include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
 
 static ShortestPathAlgorithmRegistrator<IterativeDeepeningDFS> registrator("dfs-shortest");
@@ -9,13 +9,20 @@ IterativeDeepeningDFS::IterativeDeepeningDFS(const String& id) :
 {
 }
 
+///
+/// The search counts the edges of a path and ignores their weights.
+///
+bool IterativeDeepeningDFS::findsWeightedShortestPaths() const
+{
+	return false;
+}
+
 void IterativeDeepeningDFS::initialise(const Graph& graph,
 									   const Vertex& source,
 									   const Vertex& target)
 {
 	decorateVerticesOf(graph);
 	initialiseSource(getDecoratedVersionOf(source));
-	setGraph(graph);
 	setTarget(target);
 	foundAShortestPath = false;
 }
@@ -27,15 +34,20 @@ void IterativeDeepeningDFS::execute(const Graph& graph,
 	unsigned maxLengthOfShortestPath = graph.getVerticesCount() - 1;
 	unsigned depth = 0;
 
-	while (!foundAShortestPath && depth <= maxLengthOfShortestPath)
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
 	{
-		depthLimitedSearch(getDecoratedVersionOf(source), depth);
-		++depth;
-	}
+		while (!foundAShortestPath && depth <= maxLengthOfShortestPath)
+		{
+			depthLimitedSearch(getDecoratedVersionOf(source), depth, concreteGraph);
+			++depth;
+		}
+	});
 }
 
+template <class ConcreteGraph>
 void IterativeDeepeningDFS::depthLimitedSearch(MarkableDecoratedVertex& vertex,
-											   unsigned depth)
+											   unsigned depth,
+											   const ConcreteGraph& graph)
 {
 	vertex.isVisited = true;
 
@@ -45,34 +57,30 @@ void IterativeDeepeningDFS::depthLimitedSearch(MarkableDecoratedVertex& vertex,
 	}
 	else
 	{
-		expandSearch(vertex, depth - 1);
+		expandSearch(vertex, depth - 1, graph);
 	}
 
 	vertex.isVisited = false;
 }
 
+template <class ConcreteGraph>
 void IterativeDeepeningDFS::expandSearch(const MarkableDecoratedVertex& predecessor,
-										 unsigned depth)
+										 unsigned depth,
+										 const ConcreteGraph& graph)
 {
-	Graph::EdgesConstIterator iterator =
-		graph->getConstIteratorOfEdgesLeaving(predecessor.originalVertex);
-
-	while (!foundAShortestPath && *iterator)
+	graph.forEachEdgeLeaving(*predecessor.originalVertex, [&](const Edge& e)
 	{
-		MarkableDecoratedVertex& successor =
-			getDecoratedVersionOf((*iterator)->getVertex());
+		if (foundAShortestPath)
+		{
+			return;
+		}
+
+		MarkableDecoratedVertex& successor = getDecoratedVersionOf(e.getVertex());
 
 		if (!successor.isVisited)
 		{
 			visitVertex(successor, predecessor);
-			depthLimitedSearch(successor, depth);
+			depthLimitedSearch(successor, depth, graph);
 		}
-
-		++(*iterator);
-	}
-}
-
-void IterativeDeepeningDFS::setGraph(const Graph& graph)
-{
-	this->graph = &graph;
-}
+	});
+}
\ No newline at end of file
@@ -9,16 +9,17 @@ public:
 	explicit IterativeDeepeningDFS(const String& id);
 	IterativeDeepeningDFS(const IterativeDeepeningDFS&) = delete;
 	IterativeDeepeningDFS& operator=(const IterativeDeepeningDFS&) = delete;
+	virtual bool findsWeightedShortestPaths() const override;
 
 private:
 	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
 	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
-	void depthLimitedSearch(MarkableDecoratedVertex& vertex, unsigned depth);
-	void expandSearch(const MarkableDecoratedVertex& predecessor, unsigned depth);
-	void setGraph(const Graph& graph);
 
-private:
-	const Graph* graph;
+	template <class ConcreteGraph>
+	void depthLimitedSearch(MarkableDecoratedVertex& vertex, unsigned depth, const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void expandSearch(const MarkableDecoratedVertex& predecessor, unsigned depth, const ConcreteGraph& graph);
 };
 
 #endif //__ITERATIVE_DEEPENING_DFS_HEADER_INCLUDED__
\ No newline at end of file
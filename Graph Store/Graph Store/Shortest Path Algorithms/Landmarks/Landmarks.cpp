@@ -0,0 +1,202 @@
+#include "Landmarks.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include "../../Priority Queue/PriorityQueue.h"
+#include <algorithm>
+
+const unsigned Landmarks::UNREACHABLE;
+
+Landmarks::Landmarks(const Graph& graph, size_t count) :
+	verticesCount(graph.getVerticesCount()),
+	isDirected(graph.isDirected())
+{
+	VerticesArray vertices(verticesCount);
+
+	forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+	{
+		assert(v->getIndex() < vertices.size());
+
+		vertices[v->getIndex()] = v;
+	});
+
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		selectLandmarks(concreteGraph, vertices, count);
+	});
+}
+
+template <class ConcreteGraph>
+void Landmarks::selectLandmarks(const ConcreteGraph& graph,
+								const VerticesArray& vertices,
+								size_t count)
+{
+	if (vertices.empty())
+	{
+		return;
+	}
+
+	DistancesArray closeness;
+	measureDistances(graph, *vertices.front(), false, closeness);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		size_t farthest = findFarthestVertex(closeness);
+
+		if (closeness[farthest] == 0)
+		{
+			break;
+		}
+
+		addLandmark(graph, *vertices[farthest]);
+
+		updateCloseness(closeness, distancesFromLandmarks.back());
+
+		if (isDirected)
+		{
+			updateCloseness(closeness, distancesToLandmarks.back());
+		}
+	}
+}
+
+size_t Landmarks::findFarthestVertex(const DistancesArray& closeness)
+{
+	return std::max_element(closeness.cbegin(), closeness.cend()) - closeness.cbegin();
+}
+
+void Landmarks::updateCloseness(DistancesArray& closeness, const DistancesArray& distances)
+{
+	for (size_t i = 0; i < closeness.size(); ++i)
+	{
+		closeness[i] = std::min(closeness[i], distances[i]);
+	}
+}
+
+template <class ConcreteGraph>
+void Landmarks::addLandmark(const ConcreteGraph& graph, const Vertex& landmark)
+{
+	distancesFromLandmarks.emplace_back();
+	measureDistances(graph, landmark, false, distancesFromLandmarks.back());
+
+	if (isDirected)
+	{
+		distancesToLandmarks.emplace_back();
+		measureDistances(graph, landmark, true, distancesToLandmarks.back());
+	}
+}
+
+///
+/// Runs Dijkstra's algorithm from the landmark over the leaving edges, or
+/// over the entering ones to measure the distances to the landmark. Stale
+/// entries are skipped when extracted instead of having their keys
+/// decreased, so no handles have to be kept for the vertices.
+///
+template <class ConcreteGraph>
+void Landmarks::measureDistances(const ConcreteGraph& graph,
+								 const Vertex& landmark,
+								 bool isBackward,
+								 DistancesArray& distances) const
+{
+	PriorityQueue<QueueEntry> queue;
+
+	distances.assign(verticesCount, UNREACHABLE);
+	distances[landmark.getIndex()] = 0;
+	queue.add(QueueEntry(&landmark, 0));
+
+	auto relaxEdge = [&](unsigned distanceToStart, const Edge& e)
+	{
+		unsigned distanceThroughStart = distanceToStart + e.getWeight();
+		unsigned& distanceToEnd = distances[e.getVertex().getIndex()];
+
+		if (distanceThroughStart < distanceToEnd)
+		{
+			distanceToEnd = distanceThroughStart;
+			queue.add(QueueEntry(&e.getVertex(), distanceThroughStart));
+		}
+	};
+
+	while (!queue.isEmpty())
+	{
+		QueueEntry entry = queue.extractOptimal();
+
+		if (entry.distance != distances[entry.vertex->getIndex()])
+		{
+			continue;
+		}
+
+		if (isBackward)
+		{
+			graph.forEachEdgeEntering(*entry.vertex, [&](const Edge& e)
+			{
+				relaxEdge(entry.distance, e);
+			});
+		}
+		else
+		{
+			graph.forEachEdgeLeaving(*entry.vertex, [&](const Edge& e)
+			{
+				relaxEdge(entry.distance, e);
+			});
+		}
+	}
+}
+
+///
+/// A landmark which reaches v but not the target proves that v does not
+/// reach the target either, and so does a landmark reached by the target
+/// but not by v.
+///
+Distance Landmarks::getLowerBoundOfDistanceBetween(const Vertex& v, const Vertex& target) const
+{
+	const DistancesTable& distancesToLandmarks = getDistancesToLandmarks();
+	size_t vIndex = v.getIndex();
+	size_t targetIndex = target.getIndex();
+	unsigned lowerBound = 0;
+
+	for (size_t i = 0; i < distancesFromLandmarks.size(); ++i)
+	{
+		unsigned fromLandmarkToV = distancesFromLandmarks[i][vIndex];
+		unsigned fromLandmarkToTarget = distancesFromLandmarks[i][targetIndex];
+
+		if (fromLandmarkToTarget == UNREACHABLE)
+		{
+			if (fromLandmarkToV != UNREACHABLE)
+			{
+				return Distance::getInfinity();
+			}
+		}
+		else if (fromLandmarkToV < fromLandmarkToTarget)
+		{
+			lowerBound = std::max(lowerBound, fromLandmarkToTarget - fromLandmarkToV);
+		}
+
+		unsigned fromVToLandmark = distancesToLandmarks[i][vIndex];
+		unsigned fromTargetToLandmark = distancesToLandmarks[i][targetIndex];
+
+		if (fromVToLandmark == UNREACHABLE)
+		{
+			if (fromTargetToLandmark != UNREACHABLE)
+			{
+				return Distance::getInfinity();
+			}
+		}
+		else if (fromTargetToLandmark < fromVToLandmark)
+		{
+			lowerBound = std::max(lowerBound, fromVToLandmark - fromTargetToLandmark);
+		}
+	}
+
+	return lowerBound;
+}
+
+///
+/// In an undirected graph the distance to a landmark is the distance
+/// from it, so only one table is kept.
+///
+const Landmarks::DistancesTable& Landmarks::getDistancesToLandmarks() const
+{
+	return isDirected ? distancesToLandmarks : distancesFromLandmarks;
+}
+
+size_t Landmarks::getCount() const
+{
+	return distancesFromLandmarks.size();
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef __LANDMARKS_HEADER_INCLUDED__
+#define __LANDMARKS_HEADER_INCLUDED__
+
+#include "../../Distance/Distance.h"
+#include <vector>
+
+class Graph;
+class Vertex;
+
+///
+/// A few vertices of a graph together with the distances from each of them
+/// to every vertex and from every vertex to each of them, indexed by vertex
+/// index. By the triangle inequality, for every landmark L:
+///
+///		d(v, t) >= d(L, t) - d(L, v)  and  d(v, t) >= d(v, L) - d(t, L),
+///
+/// which gives admissible and consistent lower bounds for A* search.
+///
+/// The landmarks are picked by the farthest-point heuristic: each next one
+/// is the vertex farthest from the landmarks picked so far, starting with
+/// the vertex farthest from the first vertex of the graph. Unreachable
+/// vertices count as farthest, so every component gets a landmark first.
+///
+class Landmarks
+{
+	typedef std::vector<unsigned> DistancesArray;
+	typedef std::vector<DistancesArray> DistancesTable;
+	typedef std::vector<const Vertex*> VerticesArray;
+
+	struct QueueEntry
+	{
+		QueueEntry(const Vertex* vertex = nullptr, unsigned distance = 0) :
+			vertex(vertex),
+			distance(distance)
+		{
+		}
+
+		bool operator<(const QueueEntry& rhs) const
+		{
+			return distance < rhs.distance;
+		}
+
+		const Vertex* vertex;
+		unsigned distance;
+	};
+
+public:
+	Landmarks(const Graph& graph, size_t count);
+	Landmarks(const Landmarks&) = delete;
+	Landmarks& operator=(const Landmarks&) = delete;
+	~Landmarks() = default;
+
+	Distance getLowerBoundOfDistanceBetween(const Vertex& v, const Vertex& target) const;
+	size_t getCount() const;
+
+private:
+	static const unsigned UNREACHABLE = static_cast<unsigned>(-1);
+
+private:
+	static size_t findFarthestVertex(const DistancesArray& closeness);
+	static void updateCloseness(DistancesArray& closeness, const DistancesArray& distances);
+
+private:
+	template <class ConcreteGraph>
+	void selectLandmarks(const ConcreteGraph& graph, const VerticesArray& vertices, size_t count);
+
+	template <class ConcreteGraph>
+	void addLandmark(const ConcreteGraph& graph, const Vertex& landmark);
+
+	template <class ConcreteGraph>
+	void measureDistances(const ConcreteGraph& graph,
+						  const Vertex& landmark,
+						  bool isBackward,
+						  DistancesArray& distances) const;
+
+	const DistancesTable& getDistancesToLandmarks() const;
+
+private:
+	DistancesTable distancesFromLandmarks;
+	DistancesTable distancesToLandmarks;
+	size_t verticesCount;
+	bool isDirected;
+};
+
+#endif //__LANDMARKS_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "MonotoneDijkstraShortestPath.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include "../../Bucket Queue/BucketQueue.h"
+#include "../../Radix Heap/RadixHeap.h"
+#include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
+
+static ShortestPathAlgorithmRegistrator<MonotoneDijkstraShortestPath<BucketQueue>> dialRegistrator("dijkstra-dial");
+static ShortestPathAlgorithmRegistrator<MonotoneDijkstraShortestPath<RadixHeap>> radixRegistrator("dijkstra-radix");
+
+template <template <class> class Queue>
+MonotoneDijkstraShortestPath<Queue>::MonotoneDijkstraShortestPath(const String& id) :
+	ShortestPathAlgorithm(id)
+{
+}
+
+template <template <class> class Queue>
+void MonotoneDijkstraShortestPath<Queue>::initialise(const Graph& graph,
+													 const Vertex& source,
+													 const Vertex& target)
+{
+	decorateVerticesOf(graph);
+	addSourceToUndeterminedEstimateVertices(source);
+}
+
+template <template <class> class Queue>
+void MonotoneDijkstraShortestPath<Queue>::decorateVerticesOf(const Graph& graph)
+{
+	decoratedVertices.startNewSession(graph.getVerticesCount());
+}
+
+template <template <class> class Queue>
+typename MonotoneDijkstraShortestPath<Queue>::MonotoneDijkstraVertex&
+MonotoneDijkstraShortestPath<Queue>::getDecoratedVersionOf(const Vertex& v)
+{
+	return decoratedVertices[v];
+}
+
+template <template <class> class Queue>
+void MonotoneDijkstraShortestPath<Queue>::addSourceToUndeterminedEstimateVertices(const Vertex& source)
+{
+	MonotoneDijkstraVertex& decoratedSource = getDecoratedVersionOf(source);
+
+	initialiseSource(decoratedSource);
+	decoratedSource.distance = 0;
+	undeterminedEstimateVertices.add(&decoratedSource, 0);
+}
+
+template <template <class> class Queue>
+void MonotoneDijkstraShortestPath<Queue>::execute(const Graph& graph,
+												  const Vertex& source,
+												  const Vertex& target)
+{
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		searchForShortestPathTo(target, concreteGraph);
+	});
+}
+
+template <template <class> class Queue>
+template <class ConcreteGraph>
+void MonotoneDijkstraShortestPath<Queue>::searchForShortestPathTo(const Vertex& target,
+																  const ConcreteGraph& graph)
+{
+	MonotoneDijkstraVertex* v;
+
+	while (!undeterminedEstimateVertices.isEmpty())
+	{
+		v = undeterminedEstimateVertices.extractOptimal();
+
+		if (v->isDetermined)
+		{
+			continue;
+		}
+
+		v->isDetermined = true;
+
+		if (v->originalVertex == &target)
+		{
+			return;
+		}
+
+		relaxEdgesLeaving(*v, graph);
+	}
+}
+
+template <template <class> class Queue>
+template <class ConcreteGraph>
+void MonotoneDijkstraShortestPath<Queue>::relaxEdgesLeaving(const MonotoneDijkstraVertex& start,
+															const ConcreteGraph& graph)
+{
+	graph.forEachEdgeLeaving(*start.originalVertex, [&](const Edge& e)
+	{
+		MonotoneDijkstraVertex& end = getDecoratedVersionOf(e.getVertex());
+
+		relaxEdge(start, end, e.getWeight());
+	});
+}
+
+template <template <class> class Queue>
+void MonotoneDijkstraShortestPath<Queue>::relaxEdge(const MonotoneDijkstraVertex& start,
+													MonotoneDijkstraVertex& end,
+													unsigned weight)
+{
+	unsigned distanceThroughStart = start.distance + weight;
+
+	if (distanceThroughStart < end.distance)
+	{
+		end.distance = distanceThroughStart;
+		end.distanceToSource = distanceThroughStart;
+		end.parent = &start;
+
+		undeterminedEstimateVertices.add(&end, distanceThroughStart);
+	}
+}
+
+template <template <class> class Queue>
+void MonotoneDijkstraShortestPath<Queue>::cleanUp()
+{
+	undeterminedEstimateVertices.empty();
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef __MONOTONE_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
+#define __MONOTONE_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../Decorated Vertices/DecoratedVertices.h"
+
+///
+/// Dijkstra's algorithm over a monotone integer priority queue (BucketQueue
+/// or RadixHeap), which relies on the edge weights being unsigned integers
+/// and on Dijkstra's algorithm never extracting a key lower than the last.
+///
+/// These queues have no decrease-key, so a vertex is added again whenever
+/// its distance improves. Only its first extraction, with the lowest key,
+/// determines it and the later ones are skipped.
+///
+template <template <class> class Queue>
+class MonotoneDijkstraShortestPath : public ShortestPathAlgorithm
+{
+	struct MonotoneDijkstraVertex : public DecoratedVertex
+	{
+		MonotoneDijkstraVertex(const Vertex* originalVertex = nullptr) :
+			DecoratedVertex(originalVertex),
+			distance(UNREACHED),
+			isDetermined(false)
+		{
+		}
+
+		unsigned distance;
+		bool isDetermined;
+	};
+
+public:
+	explicit MonotoneDijkstraShortestPath(const String& id);
+	MonotoneDijkstraShortestPath(const MonotoneDijkstraShortestPath<Queue>&) = delete;
+	MonotoneDijkstraShortestPath<Queue>& operator=(const MonotoneDijkstraShortestPath<Queue>&) = delete;
+
+private:
+	static const unsigned UNREACHED = static_cast<unsigned>(-1);
+
+private:
+	virtual void initialise(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void execute(const Graph& graph, const Vertex& source, const Vertex& target) override;
+	virtual void cleanUp() override;
+	virtual MonotoneDijkstraVertex& getDecoratedVersionOf(const Vertex& vertex) override;
+	void decorateVerticesOf(const Graph& graph);
+	void addSourceToUndeterminedEstimateVertices(const Vertex& source);
+	void relaxEdge(const MonotoneDijkstraVertex& start, MonotoneDijkstraVertex& end, unsigned weight);
+
+	template <class ConcreteGraph>
+	void searchForShortestPathTo(const Vertex& target, const ConcreteGraph& graph);
+
+	template <class ConcreteGraph>
+	void relaxEdgesLeaving(const MonotoneDijkstraVertex& vertex, const ConcreteGraph& graph);
+
+private:
+	Queue<MonotoneDijkstraVertex*> undeterminedEstimateVertices;
+	DecoratedVertices<MonotoneDijkstraVertex> decoratedVertices;
+};
+
+#endif //__MONOTONE_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
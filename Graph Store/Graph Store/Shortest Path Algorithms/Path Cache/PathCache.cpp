@@ -0,0 +1,180 @@
+#include "PathCache.h"
+#include "../../Graph/Abstract class/Graph.h"
+#include "../../Hash/Hash Function/HashFunctionPointerSpecialization.h"
+
+const size_t PathCache::DEFAULT_MEMORY_LIMIT;
+
+bool PathCache::Key::operator!=(const Key& rhs) const
+{
+	return graph != rhs.graph
+		   || graphVersion != rhs.graphVersion
+		   || source != rhs.source
+		   || target != rhs.target
+		   || algorithm != rhs.algorithm;
+}
+
+unsigned PathCache::KeyHashFunction::operator()(const Key& key) const
+{
+	HashFunction<const void*> hashPointer;
+
+	unsigned hashValue = hashPointer(key.source);
+	hashValue = 31 * hashValue + hashPointer(key.target);
+	hashValue = 31 * hashValue + hashPointer(key.algorithm);
+	hashValue = 31 * hashValue + static_cast<unsigned>(key.graphVersion);
+
+	return hashValue;
+}
+
+///
+/// Besides the path itself, an entry takes its list node and about two
+/// slots of the hash.
+///
+PathCache::Entry::Entry(const Key& key, const ShortestPathAlgorithm::Path& path) :
+	key(key),
+	path(path),
+	memoryUsage(sizeof(Entry) - sizeof(path) + path.getMemoryUsage() + 4 * sizeof(void*))
+{
+}
+
+PathCache::PathCache() :
+	index(INITIAL_INDEX_SIZE),
+	memoryLimit(DEFAULT_MEMORY_LIMIT),
+	memoryUsage(0),
+	hitsCount(0),
+	missesCount(0)
+{
+}
+
+PathCache& PathCache::instance()
+{
+	static PathCache theOnlyInstance;
+
+	return theOnlyInstance;
+}
+
+PathCache::Key PathCache::createKey(const Graph& graph,
+									const Vertex& source,
+									const Vertex& target,
+									const ShortestPathAlgorithm& algorithm)
+{
+	return Key{ &graph, graph.getVersion(), &source, &target, &algorithm };
+}
+
+///
+/// A path found is moved to the front of the list as the most recently
+/// used one.
+///
+const ShortestPathAlgorithm::Path* PathCache::search(const Graph& graph,
+													 const Vertex& source,
+													 const Vertex& target,
+													 const ShortestPathAlgorithm& algorithm)
+{
+	Entry* entry = index.search(createKey(graph, source, target, algorithm));
+
+	if (entry == nullptr)
+	{
+		++missesCount;
+		return nullptr;
+	}
+
+	entries.splice(entries.begin(), entries, entry->position);
+	++hitsCount;
+
+	return &entry->path;
+}
+
+///
+/// A path which alone takes more memory than the limit is not added.
+///
+void PathCache::add(const Graph& graph,
+					const Vertex& source,
+					const Vertex& target,
+					const ShortestPathAlgorithm& algorithm,
+					const ShortestPathAlgorithm::Path& path)
+{
+	Key key = createKey(graph, source, target, algorithm);
+	assert(index.search(key) == nullptr);
+
+	entries.emplace_front(key, path);
+	Entry& entry = entries.front();
+	entry.position = entries.begin();
+
+	if (entry.memoryUsage > memoryLimit)
+	{
+		entries.pop_front();
+		return;
+	}
+
+	try
+	{
+		index.add(entry);
+	}
+	catch (std::bad_alloc&)
+	{
+		entries.pop_front();
+		throw;
+	}
+
+	memoryUsage += entry.memoryUsage;
+	evictUntilWithin(memoryLimit);
+}
+
+void PathCache::evictUntilWithin(size_t memoryLimit)
+{
+	while (memoryUsage > memoryLimit)
+	{
+		evictLeastRecentlyUsed();
+	}
+}
+
+void PathCache::evictLeastRecentlyUsed()
+{
+	assert(!entries.empty());
+
+	Entry& entry = entries.back();
+
+	index.remove(entry.key);
+	memoryUsage -= entry.memoryUsage;
+	entries.pop_back();
+}
+
+void PathCache::empty()
+{
+	index.empty();
+	entries.clear();
+	memoryUsage = 0;
+}
+
+///
+/// A limit of 0 turns the cache off.
+///
+void PathCache::setMemoryLimit(size_t bytes)
+{
+	memoryLimit = bytes;
+	evictUntilWithin(memoryLimit);
+}
+
+size_t PathCache::getMemoryLimit() const
+{
+	return memoryLimit;
+}
+
+size_t PathCache::getMemoryUsage() const
+{
+	return memoryUsage;
+}
+
+size_t PathCache::getEntriesCount() const
+{
+	return entries.size();
+}
+
+size_t PathCache::getHitsCount() const
+{
+	return hitsCount;
+}
+
+size_t PathCache::getMissesCount() const
+{
+	return missesCount;
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#ifndef __PATH_CACHE_HEADER_INCLUDED__
+#define __PATH_CACHE_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "../../Hash/Hash.h"
+#include <cstdint>
+#include <list>
+
+///
+/// The most recently found paths, each under the graph and its version,
+/// the source, the target and the algorithm it was found with. A path is
+/// found again only while the version of the graph is the same, so any
+/// modification of the graph makes its paths unreachable and they are
+/// evicted in time.
+///
+/// The entries are kept in a list from the most to the least recently
+/// used, with a hash of them by key, and the least recently used ones are
+/// evicted whenever the memory they take exceeds the limit.
+///
+class PathCache
+{
+	struct Key
+	{
+		bool operator!=(const Key& rhs) const;
+
+		const Graph* graph;
+		std::uint64_t graphVersion;
+		const Vertex* source;
+		const Vertex* target;
+		const ShortestPathAlgorithm* algorithm;
+	};
+
+	struct Entry;
+
+	typedef std::list<Entry> EntriesList;
+
+	struct Entry
+	{
+		Entry(const Key& key, const ShortestPathAlgorithm::Path& path);
+
+		Key key;
+		ShortestPathAlgorithm::Path path;
+		size_t memoryUsage;
+		EntriesList::iterator position;
+	};
+
+	class KeyAccessor
+	{
+	public:
+		const Key& operator()(const Entry& entry) const
+		{
+			return entry.key;
+		}
+	};
+
+	class KeyHashFunction
+	{
+	public:
+		unsigned operator()(const Key& key) const;
+	};
+
+	typedef Hash<Entry, Key, KeyAccessor, KeyHashFunction> Index;
+
+public:
+	static PathCache& instance();
+
+public:
+	const ShortestPathAlgorithm::Path* search(const Graph& graph,
+											  const Vertex& source,
+											  const Vertex& target,
+											  const ShortestPathAlgorithm& algorithm);
+	void add(const Graph& graph,
+			 const Vertex& source,
+			 const Vertex& target,
+			 const ShortestPathAlgorithm& algorithm,
+			 const ShortestPathAlgorithm::Path& path);
+	void empty();
+
+	void setMemoryLimit(size_t bytes);
+	size_t getMemoryLimit() const;
+	size_t getMemoryUsage() const;
+	size_t getEntriesCount() const;
+	size_t getHitsCount() const;
+	size_t getMissesCount() const;
+
+private:
+	static const size_t DEFAULT_MEMORY_LIMIT = 16 * 1024 * 1024;
+	static const size_t INITIAL_INDEX_SIZE = 64;
+
+private:
+	static Key createKey(const Graph& graph,
+						 const Vertex& source,
+						 const Vertex& target,
+						 const ShortestPathAlgorithm& algorithm);
+
+private:
+	PathCache();
+	PathCache(const PathCache&) = delete;
+	PathCache& operator=(const PathCache&) = delete;
+	~PathCache() = default;
+
+	void evictUntilWithin(size_t memoryLimit);
+	void evictLeastRecentlyUsed();
+
+private:
+	EntriesList entries;
+	Index index;
+	size_t memoryLimit;
+	size_t memoryUsage;
+	size_t hitsCount;
+	size_t missesCount;
+};
+
+#endif //__PATH_CACHE_HEADER_INCLUDED__
\ No newline at end of file
@@ -9,25 +9,17 @@ SearchBasedShortestPathAlgorithm::SearchBasedShortestPathAlgorithm(const String&
 
 void SearchBasedShortestPathAlgorithm::decorateVerticesOf(const Graph& graph)
 {
-	decoratedVertices.reserve(graph.getVerticesCount());
-
-	ShortestPathAlgorithm::decorateVerticesOf(graph);
-}
-
-void SearchBasedShortestPathAlgorithm::addDecoratedVersionOf(const Vertex& v)
-{
-	decoratedVertices.emplace(v.getID(), v);
+	decoratedVertices.startNewSession(graph.getVerticesCount());
 }
 
 SearchBasedShortestPathAlgorithm::MarkableDecoratedVertex&
 SearchBasedShortestPathAlgorithm::getDecoratedVersionOf(const Vertex& v)
 {
-	return decoratedVertices[v.getID()];
+	return decoratedVertices[v];
 }
 
 void SearchBasedShortestPathAlgorithm::cleanUp()
 {
-	decoratedVertices.clear();
 }
 
 void SearchBasedShortestPathAlgorithm::visitVertex(MarkableDecoratedVertex& successor,
@@ -39,7 +31,7 @@ void SearchBasedShortestPathAlgorithm::visitVertex(MarkableDecoratedVertex& succ
 
 void SearchBasedShortestPathAlgorithm::checkIfTarget(const MarkableDecoratedVertex& v)
 {
-	if (v.originalVertex == *target)
+	if (v.originalVertex == target)
 	{
 		assert(!foundAShortestPath);
 
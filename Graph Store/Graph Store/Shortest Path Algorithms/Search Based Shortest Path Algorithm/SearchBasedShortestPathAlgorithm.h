@@ -2,15 +2,14 @@
 #define __SEARCH_BASED_SHORTEST_PATH_ALGORITHM_HEADER_INCLUDED__
 
 #include "../Abstract class/ShortestPathAlgorithm.h"
-#include "../../Hash/Hash Function/HashFunctionStringSpecialization.h"
-#include <unordered_map>
+#include "../Decorated Vertices/DecoratedVertices.h"
 
 class SearchBasedShortestPathAlgorithm : public ShortestPathAlgorithm
 {
 protected:
 	struct MarkableDecoratedVertex : public DecoratedVertex
 	{
-		MarkableDecoratedVertex(const Vertex& originalVertex) :
+		MarkableDecoratedVertex(const Vertex* originalVertex = nullptr) :
 			DecoratedVertex(originalVertex),
 			isVisited(false)
 		{
@@ -19,16 +18,12 @@ protected:
 		bool isVisited;
 	};
 
-private:
-	typedef std::unordered_map<String, MarkableDecoratedVertex, HashFunction<String>> Hash;
-
 protected:
 	SearchBasedShortestPathAlgorithm(const String& id);
 	SearchBasedShortestPathAlgorithm(const SearchBasedShortestPathAlgorithm&) = delete;
 	SearchBasedShortestPathAlgorithm& operator=(const SearchBasedShortestPathAlgorithm&) = delete;
 
 	virtual void cleanUp() override;
-	virtual void addDecoratedVersionOf(const Vertex& v) override;
 	virtual MarkableDecoratedVertex& getDecoratedVersionOf(const Vertex& v) override;
 	virtual void visitVertex(MarkableDecoratedVertex& successor,
 							 const MarkableDecoratedVertex& predecessor);
@@ -41,7 +36,7 @@ protected:
 
 private:
 	const Vertex* target;
-	Hash decoratedVertices;
+	DecoratedVertices<MarkableDecoratedVertex> decoratedVertices;
 };
 
 #endif //__SEARCH_BASED_SHORTEST_PATH_ALGORITHM_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include "ShortestPathTree.h"
+#include "../../Graph/Graph Dispatch/GraphDispatch.h"
+#include "../../Priority Queue/PriorityQueue.h"
+
+const unsigned ShortestPathTree::UNREACHED;
+
+ShortestPathTree::ShortestPathTree() :
+	source(nullptr)
+{
+}
+
+///
+/// With no targets the whole part of the graph reachable from the source
+/// is settled.
+///
+void ShortestPathTree::grow(const Graph& graph, const Vertex& source, const VerticesArray& targets)
+{
+	reset(source, graph.getVerticesCount());
+
+	dispatchOnConcreteType(graph, [&](const auto& concreteGraph)
+	{
+		search(concreteGraph, source, targets);
+	});
+}
+
+void ShortestPathTree::reset(const Vertex& source, size_t verticesCount)
+{
+	this->source = &source;
+	distances.assign(verticesCount, UNREACHED);
+	parents.assign(verticesCount, nullptr);
+}
+
+///
+/// Stale entries are skipped when extracted, as in Landmarks. Once the
+/// last target is settled, the entries left in the queue which are not
+/// stale are exactly the vertices reached but not settled, so they are
+/// taken out of the tree.
+///
+template <class ConcreteGraph>
+void ShortestPathTree::search(const ConcreteGraph& graph, const Vertex& source, const VerticesArray& targets)
+{
+	PriorityQueue<QueueEntry, Less, QueueEntry, IdentityKeyAccessor, EmptyMethodFunctor, 4> queue;
+	std::vector<bool> isPendingTarget(distances.size(), false);
+	size_t pendingTargetsCount = 0;
+
+	for (const Vertex* target : targets)
+	{
+		if (!isPendingTarget[target->getIndex()])
+		{
+			isPendingTarget[target->getIndex()] = true;
+			++pendingTargetsCount;
+		}
+	}
+
+	distances[source.getIndex()] = 0;
+	queue.add(QueueEntry(&source, 0));
+
+	while (!queue.isEmpty())
+	{
+		QueueEntry entry = queue.extractOptimal();
+		size_t index = entry.vertex->getIndex();
+
+		if (entry.distance != distances[index])
+		{
+			continue;
+		}
+
+		if (isPendingTarget[index])
+		{
+			isPendingTarget[index] = false;
+
+			if (--pendingTargetsCount == 0)
+			{
+				break;
+			}
+		}
+
+		graph.forEachEdgeLeaving(*entry.vertex, [&](const Edge& e)
+		{
+			unsigned distanceThroughVertex = entry.distance + e.getWeight();
+			size_t endIndex = e.getVertex().getIndex();
+
+			if (distanceThroughVertex < distances[endIndex])
+			{
+				distances[endIndex] = distanceThroughVertex;
+				parents[endIndex] = entry.vertex;
+				queue.add(QueueEntry(&e.getVertex(), distanceThroughVertex));
+			}
+		});
+	}
+
+	while (!queue.isEmpty())
+	{
+		QueueEntry entry = queue.extractOptimal();
+		size_t index = entry.vertex->getIndex();
+
+		if (entry.distance == distances[index])
+		{
+			distances[index] = UNREACHED;
+			parents[index] = nullptr;
+		}
+	}
+}
+
+bool ShortestPathTree::isReached(const Vertex& v) const
+{
+	assert(v.getIndex() < distances.size());
+
+	return distances[v.getIndex()] != UNREACHED;
+}
+
+Distance ShortestPathTree::getDistanceTo(const Vertex& v) const
+{
+	return isReached(v) ? Distance(distances[v.getIndex()]) : Distance::getInfinity();
+}
+
+ShortestPathAlgorithm::Path ShortestPathTree::getPathTo(const Vertex& target) const
+{
+	std::forward_list<String> identifiers;
+
+	if (isReached(target))
+	{
+		for (const Vertex* v = &target; v != nullptr; v = parents[v->getIndex()])
+		{
+			identifiers.push_front(v->getID());
+		}
+	}
+
+	return ShortestPathAlgorithm::Path(std::move(identifiers), getDistanceTo(target));
+}
+
+const Vertex* ShortestPathTree::getSource() const
+{
+	return source;
+}
+
+const ShortestPathTree::DistancesArray& ShortestPathTree::getDistances() const
+{
+	return distances;
+}
+
+const ShortestPathTree::VerticesArray& ShortestPathTree::getParents() const
+{
+	return parents;
+}
\ No newline at end of file
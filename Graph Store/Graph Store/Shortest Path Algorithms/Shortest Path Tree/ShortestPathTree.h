@@ -0,0 +1,72 @@
+#ifndef __SHORTEST_PATH_TREE_HEADER_INCLUDED__
+#define __SHORTEST_PATH_TREE_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include <vector>
+
+///
+/// The shortest paths from one source, as the distance to and the parent
+/// of every vertex, indexed by vertex index.
+///
+/// The tree is grown by a single run of Dijkstra's algorithm, which stops
+/// as soon as all of the requested targets are settled, so only settled
+/// vertices are in it: the others are unreached. The path to any vertex in
+/// the tree is read off it without searching again. A tree can be grown
+/// again from another source, reusing its arrays.
+///
+class ShortestPathTree
+{
+	struct QueueEntry
+	{
+		QueueEntry(const Vertex* vertex = nullptr, unsigned distance = 0) :
+			vertex(vertex),
+			distance(distance)
+		{
+		}
+
+		bool operator<(const QueueEntry& rhs) const
+		{
+			return distance < rhs.distance;
+		}
+
+		const Vertex* vertex;
+		unsigned distance;
+	};
+
+public:
+	typedef std::vector<unsigned> DistancesArray;
+	typedef std::vector<const Vertex*> VerticesArray;
+
+public:
+	static const unsigned UNREACHED = static_cast<unsigned>(-1);
+
+public:
+	ShortestPathTree();
+	ShortestPathTree(const ShortestPathTree&) = default;
+	ShortestPathTree& operator=(const ShortestPathTree&) = default;
+	ShortestPathTree(ShortestPathTree&&) = default;
+	ShortestPathTree& operator=(ShortestPathTree&&) = default;
+	~ShortestPathTree() = default;
+
+	void grow(const Graph& graph, const Vertex& source, const VerticesArray& targets = VerticesArray());
+
+	bool isReached(const Vertex& v) const;
+	Distance getDistanceTo(const Vertex& v) const;
+	ShortestPathAlgorithm::Path getPathTo(const Vertex& target) const;
+	const Vertex* getSource() const;
+	const DistancesArray& getDistances() const;
+	const VerticesArray& getParents() const;
+
+private:
+	template <class ConcreteGraph>
+	void search(const ConcreteGraph& graph, const Vertex& source, const VerticesArray& targets);
+
+	void reset(const Vertex& source, size_t verticesCount);
+
+private:
+	const Vertex* source;
+	DistancesArray distances;
+	VerticesArray parents;
+};
+
+#endif //__SHORTEST_PATH_TREE_HEADER_INCLUDED__
\ No newline at end of file
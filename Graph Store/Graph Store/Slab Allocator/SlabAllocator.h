@@ -0,0 +1,59 @@
+#ifndef __SLAB_ALLOCATOR_HEADER_INCLUDED__
+#define __SLAB_ALLOCATOR_HEADER_INCLUDED__
+
+#include "../Dynamic Array/DynamicArray.h"
+#include <type_traits>
+
+///
+/// Hands out memory for objects of type T from large slabs instead of
+/// allocating every object on its own.
+///
+/// The allocator only manages memory: objects are constructed in the
+/// returned slots with placement new and must be destroyed before their
+/// slots are released. Released slots are recycled by later allocations
+/// and all the slabs are freed at once when the allocator is destroyed.
+///
+template <class T>
+class SlabAllocator
+{
+	union Slot
+	{
+		Slot* nextFreeSlot;
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+	};
+
+public:
+	explicit SlabAllocator(size_t firstSlabSize = DEFAULT_FIRST_SLAB_SIZE);
+	SlabAllocator(const SlabAllocator<T>&) = delete;
+	SlabAllocator<T>& operator=(const SlabAllocator<T>&) = delete;
+	~SlabAllocator();
+
+	T* allocate();
+	void release(T* object);
+	void reserve(size_t count);
+
+	size_t getSlabsCount() const;
+
+private:
+	void addSlab();
+	void addSlabWithSize(size_t size);
+	void releaseUnusedSlotsOfCurrentSlab();
+	bool hasFreeSlots() const;
+	bool isCurrentSlabFull() const;
+
+private:
+	static const size_t DEFAULT_FIRST_SLAB_SIZE = 64;
+	static const size_t MAX_SLAB_SIZE = 65536;
+	static const size_t GROWTH_RATE = 2;
+
+private:
+	DynamicArray<Slot*> slabs;
+	Slot* freeSlots;
+	Slot* nextUnusedSlot;
+	Slot* endOfCurrentSlab;
+	size_t nextSlabSize;
+};
+
+#include "SlabAllocator.hpp"
+
+#endif //__SLAB_ALLOCATOR_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include <assert.h>
+#include <new>
+#include <stdexcept>
+
+template <class T>
+SlabAllocator<T>::SlabAllocator(size_t firstSlabSize) :
+	freeSlots(nullptr),
+	nextUnusedSlot(nullptr),
+	endOfCurrentSlab(nullptr),
+	nextSlabSize(firstSlabSize)
+{
+	if (firstSlabSize == 0)
+	{
+		throw std::invalid_argument("The slab size must be positive!");
+	}
+}
+
+template <class T>
+SlabAllocator<T>::~SlabAllocator()
+{
+	for (size_t i = 0; i < slabs.getCount(); ++i)
+	{
+		delete[] slabs[i];
+	}
+}
+
+template <class T>
+T* SlabAllocator<T>::allocate()
+{
+	Slot* slot;
+
+	if (hasFreeSlots())
+	{
+		slot = freeSlots;
+		freeSlots = freeSlots->nextFreeSlot;
+	}
+	else
+	{
+		if (isCurrentSlabFull())
+		{
+			addSlab();
+		}
+
+		slot = nextUnusedSlot;
+		++nextUnusedSlot;
+	}
+
+	return reinterpret_cast<T*>(&slot->storage);
+}
+
+template <class T>
+void SlabAllocator<T>::release(T* object)
+{
+	assert(object != nullptr);
+
+	Slot* slot = reinterpret_cast<Slot*>(object);
+	slot->nextFreeSlot = freeSlots;
+	freeSlots = slot;
+}
+
+///
+/// Makes sure the next count allocations take no more slabs. The slots
+/// left in the current slab go to the free slots and a slab with the rest
+/// is added, so a graph loaded in bulk gets its edges in as few slabs as
+/// possible. The sizes of the slabs added later do not change.
+///
+template <class T>
+void SlabAllocator<T>::reserve(size_t count)
+{
+	size_t unusedSlotsCount = endOfCurrentSlab - nextUnusedSlot;
+
+	if (count > unusedSlotsCount)
+	{
+		releaseUnusedSlotsOfCurrentSlab();
+		addSlabWithSize(count - unusedSlotsCount);
+	}
+}
+
+template <class T>
+void SlabAllocator<T>::releaseUnusedSlotsOfCurrentSlab()
+{
+	while (!isCurrentSlabFull())
+	{
+		release(reinterpret_cast<T*>(&nextUnusedSlot->storage));
+		++nextUnusedSlot;
+	}
+}
+
+template <class T>
+void SlabAllocator<T>::addSlab()
+{
+	addSlabWithSize(nextSlabSize);
+
+	if (nextSlabSize < MAX_SLAB_SIZE)
+	{
+		nextSlabSize *= GROWTH_RATE;
+	}
+}
+
+template <class T>
+void SlabAllocator<T>::addSlabWithSize(size_t size)
+{
+	Slot* newSlab = new Slot[size];
+
+	try
+	{
+		slabs.add(newSlab);
+	}
+	catch (std::bad_alloc&)
+	{
+		delete[] newSlab;
+		throw;
+	}
+
+	nextUnusedSlot = newSlab;
+	endOfCurrentSlab = newSlab + size;
+}
+
+template <class T>
+inline bool SlabAllocator<T>::hasFreeSlots() const
+{
+	return freeSlots != nullptr;
+}
+
+template <class T>
+inline bool SlabAllocator<T>::isCurrentSlabFull() const
+{
+	return nextUnusedSlot == endOfCurrentSlab;
+}
+
+template <class T>
+inline size_t SlabAllocator<T>::getSlabsCount() const
+{
+	return slabs.getCount();
+}
\ No newline at end of file
@@ -76,6 +76,17 @@ String::String(const char* string) :
 	setString(string);
 }
 
+///
+/// Copies the first length characters, which need not be followed by a
+/// terminating null character.
+///
+String::String(const char* characters, size_t length) :
+	string(new char[length + 1])
+{
+	memcpy(string, characters, length);
+	string[length] = '\0';
+}
+
 String::String(String&& source) :
 	string(source.string)
 {
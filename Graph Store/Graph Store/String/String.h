@@ -9,6 +9,7 @@ public:
 	String();
 	String(char character);
 	String(const char* string);
+	String(const char* characters, size_t length);
 	String(String&& source);
 	String(const String& source);
 	String& operator=(const String &rhs);
@@ -0,0 +1,161 @@
+#include "ThreadPool.h"
+#include <assert.h>
+
+const size_t ThreadPool::MAX_THREADS_PER_HARDWARE_THREAD;
+
+///
+/// The number of hardware threads, or 1 if it cannot be found out.
+///
+size_t ThreadPool::getDefaultThreadsCount()
+{
+	unsigned hardwareThreadsCount = std::thread::hardware_concurrency();
+
+	return (hardwareThreadsCount > 0) ? hardwareThreadsCount : 1;
+}
+
+///
+/// More threads than that only take turns on the same hardware threads,
+/// so a larger count is most likely a typo.
+///
+size_t ThreadPool::getMaxThreadsCount()
+{
+	return MAX_THREADS_PER_HARDWARE_THREAD * getDefaultThreadsCount();
+}
+
+ThreadPool::ThreadPool(size_t threadsCount) :
+	task(nullptr),
+	generation(0),
+	busyWorkersCount(0),
+	isStopping(false)
+{
+	assert(threadsCount > 0);
+
+	try
+	{
+		startWorkers(threadsCount - 1);
+	}
+	catch (...)
+	{
+		stopWorkers();
+		throw;
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	stopWorkers();
+}
+
+void ThreadPool::startWorkers(size_t count)
+{
+	workers.reserve(count);
+
+	for (size_t i = 1; i <= count; ++i)
+	{
+		workers.emplace_back(&ThreadPool::work, this, i);
+	}
+}
+
+void ThreadPool::stopWorkers()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopping = true;
+	}
+
+	taskAvailable.notify_all();
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	workers.clear();
+}
+
+void ThreadPool::runOnEveryThread(const Task& task)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		assert(this->task == nullptr);
+
+		this->task = &task;
+		++generation;
+		busyWorkersCount = workers.size();
+	}
+
+	taskAvailable.notify_all();
+
+	runTaskOn(0);
+	waitForWorkers();
+}
+
+void ThreadPool::waitForWorkers()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	taskFinished.wait(lock, [&]() { return busyWorkersCount == 0; });
+
+	task = nullptr;
+
+	if (exception)
+	{
+		std::exception_ptr thrownException = exception;
+		exception = nullptr;
+
+		std::rethrow_exception(thrownException);
+	}
+}
+
+void ThreadPool::work(size_t threadIndex)
+{
+	size_t lastGeneration = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+
+			taskAvailable.wait(lock, [&]() { return isStopping || generation != lastGeneration; });
+
+			if (isStopping)
+			{
+				return;
+			}
+
+			lastGeneration = generation;
+		}
+
+		runTaskOn(threadIndex);
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (--busyWorkersCount == 0)
+		{
+			taskFinished.notify_one();
+		}
+	}
+}
+
+void ThreadPool::runTaskOn(size_t threadIndex)
+{
+	try
+	{
+		(*task)(threadIndex);
+	}
+	catch (...)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (!exception)
+		{
+			exception = std::current_exception();
+		}
+	}
+}
+
+size_t ThreadPool::getThreadsCount() const
+{
+	return workers.size() + 1;
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef __THREAD_POOL_HEADER_INCLUDED__
+#define __THREAD_POOL_HEADER_INCLUDED__
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///
+/// A fixed set of threads which run the same task together, each with its
+/// own index in [0, threads count). The calling thread takes index 0, so a
+/// pool of one thread creates no threads at all.
+///
+/// runOnEveryThread returns once every thread is done with the task. If the
+/// task throws on any of them, the first exception is rethrown to the caller.
+///
+class ThreadPool
+{
+public:
+	typedef std::function<void(size_t threadIndex)> Task;
+
+public:
+	static size_t getDefaultThreadsCount();
+	static size_t getMaxThreadsCount();
+
+public:
+	explicit ThreadPool(size_t threadsCount);
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	~ThreadPool();
+
+	void runOnEveryThread(const Task& task);
+	size_t getThreadsCount() const;
+
+private:
+	static const size_t MAX_THREADS_PER_HARDWARE_THREAD = 4;
+
+private:
+	void startWorkers(size_t count);
+	void stopWorkers();
+	void work(size_t threadIndex);
+	void runTaskOn(size_t threadIndex);
+	void waitForWorkers();
+
+private:
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable taskAvailable;
+	std::condition_variable taskFinished;
+	const Task* task;
+	std::exception_ptr exception;
+	size_t generation;
+	size_t busyWorkersCount;
+	bool isStopping;
+};
+
+#endif //__THREAD_POOL_HEADER_INCLUDED__
\ No newline at end of file
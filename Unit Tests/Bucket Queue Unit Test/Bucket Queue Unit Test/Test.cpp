@@ -0,0 +1,242 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../../../Graph Store/Graph Store/Bucket Queue/BucketQueue.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace BucketQueueUnitTest
+{
+	TEST_CLASS(BucketQueueTest)
+	{
+		typedef BucketQueue<int> Queue;
+
+		static void assertMonotoneSequenceMatchesSorting(unsigned maxKeyDifference)
+		{
+			Queue queue;
+			std::vector<unsigned> pendingKeys;
+			std::mt19937 generator(17);
+			unsigned lastKey = 0;
+
+			for (int i = 0; i < 10000; ++i)
+			{
+				if (pendingKeys.empty() || generator() % 3 != 0)
+				{
+					unsigned key = lastKey + generator() % maxKeyDifference;
+					pendingKeys.push_back(key);
+					queue.add(static_cast<int>(key), key);
+				}
+				else
+				{
+					std::vector<unsigned>::iterator minimum = std::min_element(pendingKeys.begin(), pendingKeys.end());
+
+					lastKey = *minimum;
+					Assert::AreEqual(static_cast<int>(lastKey), queue.extractOptimal());
+
+					*minimum = pendingKeys.back();
+					pendingKeys.pop_back();
+				}
+			}
+		}
+
+	public:
+		TEST_METHOD(testNewBucketQueueIsEmpty)
+		{
+			Queue queue;
+
+			Assert::IsTrue(queue.isEmpty());
+		}
+
+		TEST_METHOD(testExtractFromEmptyBucketQueueThrowsException)
+		{
+			Queue queue;
+
+			try
+			{
+				queue.extractOptimal();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (std::logic_error&)
+			{
+			}
+		}
+
+		TEST_METHOD(testItemsAreExtractedInTheOrderOfTheirKeys)
+		{
+			Queue queue;
+			unsigned keys[] = { 7, 3, 12, 0, 3, 9, 1 };
+
+			for (unsigned key : keys)
+			{
+				queue.add(static_cast<int>(key), key);
+			}
+
+			std::sort(std::begin(keys), std::end(keys));
+
+			for (unsigned key : keys)
+			{
+				Assert::AreEqual(key, queue.getOptimalKey());
+				Assert::AreEqual(static_cast<int>(key), queue.extractOptimal());
+			}
+
+			Assert::IsTrue(queue.isEmpty());
+		}
+
+		TEST_METHOD(testKeyAtTheWidthOfTheBucketsIsNotMixedWithTheCursorKey)
+		{
+			Queue queue;
+			queue.add(1, 0);
+			queue.add(2, 16);
+			queue.add(3, 15);
+
+			Assert::AreEqual(1, queue.extractOptimal());
+			Assert::AreEqual(3, queue.extractOptimal());
+			Assert::AreEqual(16u, queue.getOptimalKey());
+			Assert::AreEqual(2, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testKeysWrapAroundTheBuckets)
+		{
+			Queue queue;
+			queue.add(1, 10);
+			queue.extractOptimal();
+
+			queue.add(2, 25);
+			queue.add(3, 11);
+			queue.add(4, 20);
+
+			Assert::AreEqual(3, queue.extractOptimal());
+			Assert::AreEqual(4, queue.extractOptimal());
+			Assert::AreEqual(2, queue.extractOptimal());
+			Assert::IsTrue(queue.isEmpty());
+		}
+
+		TEST_METHOD(testGrowingKeepsTheItemsOfWrappedBuckets)
+		{
+			Queue queue;
+			queue.add(1, 10);
+			queue.extractOptimal();
+
+			queue.add(2, 12);
+			queue.add(3, 24);
+			queue.add(4, 110);
+			queue.add(5, 40);
+
+			Assert::AreEqual(2, queue.extractOptimal());
+			Assert::AreEqual(3, queue.extractOptimal());
+			Assert::AreEqual(5, queue.extractOptimal());
+			Assert::AreEqual(4, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testKeysFarApartAreExtractedInOrder)
+		{
+			Queue queue;
+			queue.add(3, 1000000);
+			queue.add(1, 0);
+			queue.add(2, 70000);
+
+			Assert::AreEqual(1, queue.extractOptimal());
+			Assert::AreEqual(2, queue.extractOptimal());
+			Assert::AreEqual(3, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testHeavyKeyIsExtractedWithoutABucketForEachKeyBelowIt)
+		{
+			Queue queue;
+			queue.add(1, 0);
+			queue.add(2, 4000000000u);
+
+			Assert::AreEqual(1, queue.extractOptimal());
+			Assert::AreEqual(4000000000u, queue.getOptimalKey());
+			Assert::AreEqual(2, queue.extractOptimal());
+			Assert::IsTrue(queue.isEmpty());
+		}
+
+		TEST_METHOD(testKeysBeyondTheBucketsAreOrderedWithKeysAddedLater)
+		{
+			Queue queue;
+			queue.add(1, 0);
+			queue.add(3, 200000);
+			queue.add(4, 200005);
+
+			Assert::AreEqual(1, queue.extractOptimal());
+			Assert::AreEqual(200000u, queue.getOptimalKey());
+
+			queue.add(5, 200002);
+
+			Assert::AreEqual(3, queue.extractOptimal());
+			Assert::AreEqual(5, queue.extractOptimal());
+			Assert::AreEqual(4, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testKeyBeyondTheBucketsIsExtractedWhenTheCursorReachesIt)
+		{
+			Queue queue;
+			queue.add(1, 0);
+			queue.add(2, 100000);
+			queue.extractOptimal();
+			queue.add(3, 60000);
+
+			Assert::AreEqual(3, queue.extractOptimal());
+
+			queue.add(4, 100001);
+
+			Assert::AreEqual(2, queue.extractOptimal());
+			Assert::AreEqual(4, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testAddingKeyBelowTheLastExtractedOneThrowsException)
+		{
+			Queue queue;
+			queue.add(1, 10);
+			queue.extractOptimal();
+
+			try
+			{
+				queue.add(2, 9);
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (std::invalid_argument&)
+			{
+			}
+		}
+
+		TEST_METHOD(testKeyEqualToTheLastExtractedOneIsAccepted)
+		{
+			Queue queue;
+			queue.add(1, 10);
+			queue.extractOptimal();
+			queue.add(2, 10);
+
+			Assert::AreEqual(2, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testEmptyRemovesAllItemsAndResetsTheKeys)
+		{
+			Queue queue;
+			queue.add(1, 5);
+			queue.add(2, 8);
+			queue.extractOptimal();
+
+			queue.empty();
+
+			Assert::IsTrue(queue.isEmpty());
+
+			queue.add(3, 0);
+
+			Assert::AreEqual(3, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testMonotoneSequenceOfOperationsMatchesSorting)
+		{
+			assertMonotoneSequenceMatchesSorting(1000);
+		}
+
+		TEST_METHOD(testMonotoneSequenceWithKeysBeyondTheBucketsMatchesSorting)
+		{
+			assertMonotoneSequenceMatchesSorting(200000);
+		}
+	};
+}
\ No newline at end of file
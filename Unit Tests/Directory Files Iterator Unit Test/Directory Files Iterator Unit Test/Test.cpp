@@ -13,6 +13,8 @@ namespace DirectoryFilesIteratorUnitTest
 		static const String EMPTY_TEST_DIRECTORY_NAME;
 		static const String TEST_DIRECTORY_NAME;
 		static const String NONEXISTENT_DIRECTORY_NAME;
+		static const String NESTED_DIRECTORY_NAME;
+		static const String SEPARATOR;
 		static const size_t FILES_COUNT = 3;
 		static File files[FILES_COUNT];
 
@@ -64,6 +66,18 @@ namespace DirectoryFilesIteratorUnitTest
 			return true;
 		}
 
+		static size_t countFiles(DirectoryFilesIterator& iterator)
+		{
+			size_t count = 0;
+
+			for (; iterator.isValid(); iterator.advance())
+			{
+				++count;
+			}
+
+			return count;
+		}
+
 		static void markAllFilesAsUnencountered()
 		{
 			for (size_t i = 0; i < FILES_COUNT; ++i)
@@ -125,11 +139,51 @@ namespace DirectoryFilesIteratorUnitTest
 			Assert::IsFalse(iterator.isValid());
 		}
 
+		TEST_METHOD(testIterationEncountersOnlyFilesMatchingThePattern)
+		{
+			DirectoryFilesIterator iterator(TEST_DIRECTORY_NAME, "testFileT*.txt");
+
+			Assert::AreEqual(size_t(2), countFiles(iterator));
+		}
+
+		TEST_METHOD(testQuestionMarkInPatternMatchesOneCharacter)
+		{
+			DirectoryFilesIterator iterator(TEST_DIRECTORY_NAME, "testFileOn?.txt");
+
+			Assert::IsTrue(iterator.isValid());
+			Assert::IsTrue(areEqual("testFileOne.txt", iterator.getNameOfCurrentFile().cString()));
+		}
+
+		TEST_METHOD(testIterationWithPatternMatchingNoFileCreatesInvalidIterator)
+		{
+			DirectoryFilesIterator iterator(TEST_DIRECTORY_NAME, "*.graph");
+
+			Assert::IsFalse(iterator.isValid());
+		}
+
+		TEST_METHOD(testRecursiveIterationEncountersFilesInSubdirectories)
+		{
+			DirectoryFilesIterator iterator(TEST_DIRECTORY_NAME, DirectoryFilesIterator::DEFAULT_PATTERN, true);
+
+			Assert::AreEqual(FILES_COUNT + 1, countFiles(iterator));
+		}
+
+		TEST_METHOD(testPathOfFileInSubdirectoryIncludesTheSubdirectory)
+		{
+			DirectoryFilesIterator iterator(TEST_DIRECTORY_NAME, "testFileFour.txt", true);
+
+			Assert::IsTrue(iterator.isValid());
+			Assert::IsTrue(areEqual((TEST_DIRECTORY_NAME + SEPARATOR + NESTED_DIRECTORY_NAME + SEPARATOR + "testFileFour.txt").cString(),
+									iterator.getPathOfCurrentFile().cString()));
+		}
+
 	};
 
 	const String DirectoryFilesIteratorTest::EMPTY_TEST_DIRECTORY_NAME = "Empty test directory";
 	const String DirectoryFilesIteratorTest::TEST_DIRECTORY_NAME = "Test directory";
 	const String DirectoryFilesIteratorTest::NONEXISTENT_DIRECTORY_NAME = "not a directory";
+	const String DirectoryFilesIteratorTest::NESTED_DIRECTORY_NAME = "Nested test directory";
+	const String DirectoryFilesIteratorTest::SEPARATOR = "\\";
 	File DirectoryFilesIteratorTest::files[FILES_COUNT] = { "testFileOne.txt",
 															"testFileTwo.txt",
 															"testFileThree.txt" };
@@ -0,0 +1,456 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../../../Graph Store/Graph Store/Graph Snapshot/Snapshot Writer/SnapshotWriter.h"
+#include "../../../Graph Store/Graph Store/Graph Snapshot/Snapshot Reader/SnapshotReader.h"
+#include "../../../Graph Store/Graph Store/Graph Snapshot/Snapshot Exception/SnapshotException.h"
+#include "../../../Graph Store/Graph Store/Graph/Directed Graph/DirectedGraph.h"
+#include "../../../Graph Store/Graph Store/Graph/Undirected Graph/UndirectedGraph.h"
+#include "../../../Graph Store/Graph Store/Graph/Static Graph/StaticGraph.h"
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace GraphSnapshotUnitTest
+{
+	TEST_CLASS(GraphSnapshotTest)
+	{
+		typedef std::tuple<std::string, std::string, unsigned> EdgeDescription;
+		typedef std::vector<EdgeDescription> EdgesList;
+		typedef std::vector<std::string> IdentifiersList;
+
+		class UnsavableGraph : public DirectedGraph
+		{
+		public:
+			explicit UnsavableGraph(const String& id) :
+				DirectedGraph(id)
+			{
+			}
+
+			virtual VerticesConstIterator getConstIteratorOfVertices() const override
+			{
+				throw std::bad_alloc();
+			}
+		};
+
+		static const String snapshotFileName;
+		static const size_t GRAPH_HEADER_OFFSET = sizeof(SnapshotFormat::FileHeader);
+		static const size_t GRAPH_ID_OFFSET = GRAPH_HEADER_OFFSET + sizeof(SnapshotFormat::GraphHeader);
+
+		static bool areEqual(const String& expected, const char* actual)
+		{
+			return expected == String(actual);
+		}
+
+		static void addEdge(Graph& graph, const char* startID, const char* endID, unsigned weight)
+		{
+			graph.addEdge(graph.getVertexWithID(startID), graph.getVertexWithID(endID), weight);
+		}
+
+		static void addVertices(Graph& graph, const IdentifiersList& identifiers)
+		{
+			for (const std::string& id : identifiers)
+			{
+				graph.addVertex(id.c_str());
+			}
+		}
+
+		static std::unique_ptr<Graph> createDirectedGraph(const char* id)
+		{
+			std::unique_ptr<Graph> graph(new DirectedGraph(id));
+
+			addVertices(*graph, { "a", "b", "c", "d" });
+			addEdge(*graph, "a", "b", 3);
+			addEdge(*graph, "b", "c", 1);
+			addEdge(*graph, "c", "a", 7);
+			addEdge(*graph, "a", "d", 2);
+			addEdge(*graph, "d", "d", 5);
+
+			return graph;
+		}
+
+		///
+		/// Its edges are stored once in a snapshot, the loop included.
+		///
+		static std::unique_ptr<Graph> createUndirectedGraph(const char* id)
+		{
+			std::unique_ptr<Graph> graph(new UndirectedGraph(id));
+
+			addVertices(*graph, { "a", "b", "c" });
+			addEdge(*graph, "a", "b", 3);
+			addEdge(*graph, "b", "c", 1);
+			addEdge(*graph, "c", "c", 4);
+			addEdge(*graph, "a", "c", 9);
+
+			return graph;
+		}
+
+		static void addTo(GraphCollection& graphs, std::unique_ptr<Graph> graph)
+		{
+			graphs.add(*graph);
+			graph.release();
+		}
+
+		static GraphCollection saveAndRestore(GraphCollection& graphs)
+		{
+			SnapshotWriter writer;
+			writer.write(graphs, snapshotFileName);
+
+			SnapshotReader reader;
+
+			return reader.read(snapshotFileName);
+		}
+
+		static GraphCollection saveAndRestore(std::unique_ptr<Graph> graph)
+		{
+			GraphCollection graphs;
+			addTo(graphs, std::move(graph));
+
+			return saveAndRestore(graphs);
+		}
+
+		static IdentifiersList identifiersOf(const Graph& graph)
+		{
+			IdentifiersList identifiers(graph.getVerticesCount());
+
+			forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+			{
+				identifiers[v->getIndex()] = v->getID().cString();
+			});
+
+			return identifiers;
+		}
+
+		///
+		/// Each edge is listed as many times as it is found leaving its
+		/// start, so an undirected loop, which is found twice, is listed
+		/// twice.
+		///
+		static EdgesList edgesOf(const Graph& graph)
+		{
+			EdgesList edges;
+
+			forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+			{
+				forEach(*graph.getConstIteratorOfEdgesLeaving(*v), [&](const Edge& e)
+				{
+					edges.emplace_back(v->getID().cString(),
+									   e.getVertex().getID().cString(),
+									   e.getWeight());
+				});
+			});
+
+			std::sort(edges.begin(), edges.end());
+
+			return edges;
+		}
+
+		static EdgesList edgesEnteringVerticesOf(const Graph& graph)
+		{
+			EdgesList edges;
+
+			forEach(*graph.getConstIteratorOfVertices(), [&](const Vertex* v)
+			{
+				forEach(*graph.getConstIteratorOfEdgesEntering(*v), [&](const Edge& e)
+				{
+					edges.emplace_back(v->getID().cString(),
+									   e.getVertex().getID().cString(),
+									   e.getWeight());
+				});
+			});
+
+			std::sort(edges.begin(), edges.end());
+
+			return edges;
+		}
+
+		static bool isFrozen(const Graph& graph)
+		{
+			return dynamic_cast<const StaticGraph*>(&graph) != nullptr;
+		}
+
+		static bool areEqual(const Graph& lhs, const Graph& rhs)
+		{
+			return lhs.getID() == rhs.getID()
+				&& lhs.isDirected() == rhs.isDirected()
+				&& isFrozen(lhs) == isFrozen(rhs)
+				&& identifiersOf(lhs) == identifiersOf(rhs)
+				&& edgesOf(lhs) == edgesOf(rhs)
+				&& edgesEnteringVerticesOf(lhs) == edgesEnteringVerticesOf(rhs);
+		}
+
+		static void assertRestoresTheSameGraph(std::unique_ptr<Graph> graph)
+		{
+			const Graph& savedGraph = *graph;
+			GraphCollection graphs;
+			addTo(graphs, std::move(graph));
+
+			GraphCollection restoredGraphs = saveAndRestore(graphs);
+
+			Assert::AreEqual(size_t(1), restoredGraphs.getCount());
+			Assert::IsTrue(areEqual(savedGraph, restoredGraphs.getGraphWithID(savedGraph.getID())));
+		}
+
+		static std::string readSnapshot()
+		{
+			std::ifstream file(snapshotFileName.cString(), std::ios::binary);
+
+			return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		}
+
+		static void overwriteSnapshot(const std::string& contents)
+		{
+			std::ofstream file(snapshotFileName.cString(), std::ios::binary | std::ios::trunc);
+			file.write(contents.data(), contents.size());
+		}
+
+		static std::string saveSnapshotOf(std::unique_ptr<Graph> graph)
+		{
+			GraphCollection graphs;
+			addTo(graphs, std::move(graph));
+
+			SnapshotWriter writer;
+			writer.write(graphs, snapshotFileName);
+
+			return readSnapshot();
+		}
+
+		static bool fileExists(const String& fileName)
+		{
+			return std::ifstream(fileName.cString()).is_open();
+		}
+
+		static SnapshotFormat::GraphHeader readFirstGraphHeaderOf(const std::string& snapshot)
+		{
+			SnapshotFormat::GraphHeader header;
+			memcpy(&header, snapshot.data() + GRAPH_HEADER_OFFSET, sizeof(header));
+
+			return header;
+		}
+
+		static void assertRestoringFailsWith(const char* message)
+		{
+			try
+			{
+				SnapshotReader reader;
+				reader.read(snapshotFileName);
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (SnapshotException& e)
+			{
+				Assert::IsTrue(areEqual(message + snapshotFileName, e.what()));
+			}
+		}
+
+	public:
+		TEST_METHOD(testRestoringADirectedGraphGivesTheSameGraph)
+		{
+			assertRestoresTheSameGraph(createDirectedGraph("directed"));
+		}
+
+		TEST_METHOD(testRestoringAnUndirectedGraphGivesTheSameGraph)
+		{
+			assertRestoresTheSameGraph(createUndirectedGraph("undirected"));
+		}
+
+		TEST_METHOD(testRestoredUndirectedLoopIsFoundTwiceLeavingItsVertex)
+		{
+			GraphCollection graphs = saveAndRestore(createUndirectedGraph("g"));
+			EdgesList edges = edgesOf(graphs.getGraphWithID("g"));
+
+			size_t loopsCount = std::count(edges.begin(), edges.end(), EdgeDescription("c", "c", 4));
+
+			Assert::AreEqual(size_t(2), loopsCount);
+		}
+
+		TEST_METHOD(testRestoringFrozenGraphsGivesFrozenGraphs)
+		{
+			assertRestoresTheSameGraph(StaticGraph::createFrozenCopyOf(*createDirectedGraph("directed")));
+			assertRestoresTheSameGraph(StaticGraph::createFrozenCopyOf(*createUndirectedGraph("undirected")));
+		}
+
+		TEST_METHOD(testRestoringAFrozenGraphRestoresItsContractionHierarchy)
+		{
+			std::unique_ptr<Graph> graph = StaticGraph::createFrozenCopyOf(*createUndirectedGraph("g"));
+			StaticGraph& frozenGraph = static_cast<StaticGraph&>(*graph);
+			frozenGraph.setContractionHierarchy(std::unique_ptr<ContractionHierarchy>(new ContractionHierarchy(frozenGraph)));
+			size_t shortcutsCount = frozenGraph.getContractionHierarchy()->getShortcutsCount();
+
+			GraphCollection graphs = saveAndRestore(std::move(graph));
+			const ContractionHierarchy* hierarchy =
+				static_cast<StaticGraph&>(graphs.getGraphWithID("g")).getContractionHierarchy();
+
+			Assert::IsNotNull(hierarchy);
+			Assert::AreEqual(shortcutsCount, hierarchy->getShortcutsCount());
+		}
+
+		TEST_METHOD(testRestoringAnEmptyGraphGivesAnEmptyGraph)
+		{
+			assertRestoresTheSameGraph(std::unique_ptr<Graph>(new DirectedGraph("empty")));
+			assertRestoresTheSameGraph(std::unique_ptr<Graph>(new UndirectedGraph("empty")));
+		}
+
+		TEST_METHOD(testRestoringAnEmptyCollectionGivesAnEmptyCollection)
+		{
+			GraphCollection graphs;
+
+			Assert::IsTrue(saveAndRestore(graphs).isEmpty());
+		}
+
+		TEST_METHOD(testRestoringSeveralGraphsGivesAllOfThem)
+		{
+			GraphCollection graphs;
+			addTo(graphs, createDirectedGraph("directed"));
+			addTo(graphs, createUndirectedGraph("undirected"));
+			addTo(graphs, StaticGraph::createFrozenCopyOf(*createDirectedGraph("frozen")));
+
+			GraphCollection restoredGraphs = saveAndRestore(graphs);
+
+			Assert::AreEqual(size_t(3), restoredGraphs.getCount());
+			Assert::IsTrue(areEqual(graphs.getGraphWithID("directed"), restoredGraphs.getGraphWithID("directed")));
+			Assert::IsTrue(areEqual(graphs.getGraphWithID("undirected"), restoredGraphs.getGraphWithID("undirected")));
+			Assert::IsTrue(areEqual(graphs.getGraphWithID("frozen"), restoredGraphs.getGraphWithID("frozen")));
+		}
+
+		TEST_METHOD(testFailedSaveLeavesThePreviousSnapshotReadable)
+		{
+			GraphCollection savedGraphs;
+			addTo(savedGraphs, createDirectedGraph("directed"));
+			SnapshotWriter().write(savedGraphs, snapshotFileName);
+
+			GraphCollection graphs;
+			addTo(graphs, createUndirectedGraph("undirected"));
+			addTo(graphs, std::unique_ptr<Graph>(new UnsavableGraph("unsavable")));
+
+			try
+			{
+				SnapshotWriter().write(graphs, snapshotFileName);
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (SnapshotException&)
+			{
+			}
+
+			SnapshotReader reader;
+			GraphCollection restoredGraphs = reader.read(snapshotFileName);
+
+			Assert::AreEqual(size_t(1), restoredGraphs.getCount());
+			Assert::IsTrue(areEqual(savedGraphs.getGraphWithID("directed"), restoredGraphs.getGraphWithID("directed")));
+			Assert::IsFalse(fileExists(snapshotFileName + ".tmp"));
+		}
+
+		TEST_METHOD(testUndirectedEdgesAreStoredOnce)
+		{
+			std::string snapshot = saveSnapshotOf(createUndirectedGraph("g"));
+
+			size_t edgesCount = static_cast<size_t>(readFirstGraphHeaderOf(snapshot).edgesCount);
+
+			Assert::AreEqual(size_t(4), edgesCount);
+		}
+
+		TEST_METHOD(testUndirectedEdgesStoredOnceAreFoundLeavingBothEnds)
+		{
+			saveSnapshotOf(createUndirectedGraph("g"));
+			SnapshotReader reader;
+			GraphCollection graphs = reader.read(snapshotFileName);
+
+			EdgesList expected = {
+				EdgeDescription("a", "b", 3), EdgeDescription("a", "c", 9),
+				EdgeDescription("b", "a", 3), EdgeDescription("b", "c", 1),
+				EdgeDescription("c", "a", 9), EdgeDescription("c", "b", 1),
+				EdgeDescription("c", "c", 4), EdgeDescription("c", "c", 4)
+			};
+
+			Assert::IsTrue(expected == edgesOf(graphs.getGraphWithID("g")));
+		}
+
+		TEST_METHOD(testTruncatedSnapshotIsRejected)
+		{
+			std::string snapshot = saveSnapshotOf(createDirectedGraph("g"));
+			overwriteSnapshot(snapshot.substr(0, snapshot.size() - 1));
+
+			assertRestoringFailsWith("The snapshot is truncated: ");
+		}
+
+		TEST_METHOD(testSnapshotTruncatedBeforeItsEdgesIsRejected)
+		{
+			std::string snapshot = saveSnapshotOf(createDirectedGraph("g"));
+			overwriteSnapshot(snapshot.substr(0, GRAPH_ID_OFFSET + SnapshotFormat::ALIGNMENT));
+
+			assertRestoringFailsWith("The snapshot is truncated: ");
+		}
+
+		TEST_METHOD(testSnapshotWithACorruptedEdgeIsRejected)
+		{
+			std::string snapshot = saveSnapshotOf(createDirectedGraph("g"));
+			size_t checksumOffset = snapshot.size() - sizeof(std::uint64_t);
+			snapshot[checksumOffset - SnapshotFormat::ALIGNMENT] ^= 1;
+			overwriteSnapshot(snapshot);
+
+			assertRestoringFailsWith("The snapshot is corrupted: ");
+		}
+
+		TEST_METHOD(testSnapshotWithACorruptedChecksumIsRejected)
+		{
+			std::string snapshot = saveSnapshotOf(createDirectedGraph("g"));
+			snapshot[snapshot.size() - 1] ^= 1;
+			overwriteSnapshot(snapshot);
+
+			assertRestoringFailsWith("The snapshot is corrupted: ");
+		}
+
+		TEST_METHOD(testPaddingIsCoveredByTheChecksum)
+		{
+			std::string snapshot = saveSnapshotOf(createDirectedGraph("g"));
+			size_t paddingOffset = GRAPH_ID_OFFSET + 1;
+			Assert::AreEqual('\0', snapshot[paddingOffset]);
+
+			snapshot[paddingOffset] = 'x';
+			overwriteSnapshot(snapshot);
+
+			assertRestoringFailsWith("The snapshot is corrupted: ");
+		}
+
+		TEST_METHOD(testSnapshotWithTrailingBytesIsRejected)
+		{
+			std::string snapshot = saveSnapshotOf(createDirectedGraph("g"));
+			overwriteSnapshot(snapshot + std::string(SnapshotFormat::ALIGNMENT, '\0'));
+
+			assertRestoringFailsWith("The snapshot is corrupted: ");
+		}
+
+		TEST_METHOD(testSnapshotOfAnotherVersionIsRejected)
+		{
+			std::string snapshot = saveSnapshotOf(createDirectedGraph("g"));
+			std::uint32_t version = SnapshotFormat::VERSION + 1;
+			memcpy(&snapshot[offsetof(SnapshotFormat::FileHeader, version)], &version, sizeof(version));
+			overwriteSnapshot(snapshot);
+
+			assertRestoringFailsWith("Unsupported version of snapshot file: ");
+		}
+
+		TEST_METHOD(testFileWithoutTheMagicIsRejected)
+		{
+			std::string snapshot = saveSnapshotOf(createDirectedGraph("g"));
+			snapshot[0] = 'X';
+			overwriteSnapshot(snapshot);
+
+			assertRestoringFailsWith("Not a snapshot file: ");
+		}
+
+		TEST_METHOD(testFileShorterThanTheHeaderIsRejected)
+		{
+			overwriteSnapshot("GSNAP");
+
+			assertRestoringFailsWith("Not a snapshot file: ");
+		}
+
+	};
+
+	const String GraphSnapshotTest::snapshotFileName = "testSnapshot.snap";
+}
\ No newline at end of file
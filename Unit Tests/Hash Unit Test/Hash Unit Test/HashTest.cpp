@@ -325,6 +325,25 @@ namespace HashUnitTest
 			}
 		}
 
+		TEST_METHOD(testSearchWithContainedKey)
+		{
+			Hash hash(1);
+			Book& insertedBook = books[0];
+			hash.add(insertedBook);
+
+			Book* book = hash.search(insertedBook.getTitle());
+
+			Assert::IsTrue(book == &insertedBook);
+		}
+
+		TEST_METHOD(testSearchWithNotContainedKeyReturnsNull)
+		{
+			Hash hash;
+			fillHashWithBooksFromTo(hash, 0, 1);
+
+			Assert::IsNull(hash.search(books[2].getTitle()));
+		}
+
 	};
 
 	Book HashTest::books[BOOKS_COUNT];
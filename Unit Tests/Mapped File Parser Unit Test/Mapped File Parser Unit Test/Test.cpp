@@ -0,0 +1,429 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include <cstring>
+#include <fstream>
+#include "../../../Graph Store/Graph Store/Mapped File Parser/MappedFileParser.h"
+#include "../../../Graph Store/Graph Store/File Parser/File Parser Exception/FileParserException.h"
+#include "../../../Graph Store/Graph Store/File Parser/Open File Fail Exception/OpenFileFailException.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace MappedFileParserUnitTest
+{
+	TEST_CLASS(MappedFileParserTest)
+	{
+	private:
+		static const String firstTestFileName;
+		static const String secondTestFileName;
+		static const String nonExistentFileName;
+
+	private:
+		static void emptyFile(const String& fileName)
+		{
+			writeTextToFile("", fileName);
+		}
+
+		static void writeTextToFile(const char* text, const String& fileName)
+		{
+			std::ofstream file(fileName.cString(), std::ios::out | std::ios::trunc | std::ios::binary);
+			assert(file.is_open());
+
+			file << text;
+
+			file.close();
+		}
+
+		static MappedFileParser parserAfterAFailedOperation()
+		{
+			writeTextToFile("-123", firstTestFileName);
+
+			MappedFileParser parser(firstTestFileName);
+
+			try
+			{
+				parser.parseUnsigned();
+			}
+			catch (FileParserException&)
+			{
+			}
+
+			return parser;
+		}
+
+		static bool areEqual(const char* lhs, const char* rhs)
+		{
+			return strcmp(lhs, rhs) == 0;
+		}
+
+		static bool areEqual(const char* expected, const MappedFileParser::Token& token)
+		{
+			return strlen(expected) == token.getLength()
+				   && strncmp(expected, token.getData(), token.getLength()) == 0;
+		}
+
+	public:
+		TEST_METHOD(testDefaultCtorOpensNoFile)
+		{
+			MappedFileParser parser;
+
+			Assert::IsFalse(parser.hasOpenedFile());
+		}
+
+		TEST_METHOD(testMoveCtorWithOpenedFile)
+		{
+			writeTextToFile("@", firstTestFileName);
+			MappedFileParser parserToMove(firstTestFileName);
+
+			MappedFileParser parser(std::move(parserToMove));
+
+			Assert::IsFalse(parserToMove.hasOpenedFile(),
+							L"The moved-from parser should not still be associated with the file!");
+			Assert::IsTrue(parser.hasOpenedFile());
+			Assert::AreEqual('@', parser.peek());
+		}
+
+		TEST_METHOD(testMoveAssignmentOpenedToOpened)
+		{
+			emptyFile(firstTestFileName);
+			writeTextToFile("@", secondTestFileName);
+			MappedFileParser parserToMove(secondTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			parser = std::move(parserToMove);
+
+			Assert::IsFalse(parserToMove.hasOpenedFile(),
+							L"The moved-from parser should not be associated with a file!");
+			Assert::IsTrue(parser.hasOpenedFile());
+			Assert::AreEqual('@', parser.peek());
+		}
+
+		TEST_METHOD(testCtorWithNonExistentFileThrowsException)
+		{
+			try
+			{
+				MappedFileParser parser(nonExistentFileName);
+				Assert::Fail(L"Constructor did not throw an exception!");
+			}
+			catch (OpenFileFailException& ex)
+			{
+				Assert::IsTrue(areEqual(("Could not open file for reading, name: " + nonExistentFileName).cString(),
+										ex.what()));
+			}
+		}
+
+		TEST_METHOD(testOpenFileWhenAFileIsAlreadyOpened)
+		{
+			emptyFile(firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+			writeTextToFile("@", secondTestFileName);
+
+			parser.openFile(secondTestFileName);
+
+			Assert::IsTrue(parser.hasOpenedFile());
+			Assert::AreEqual('@', parser.peek());
+		}
+
+		TEST_METHOD(testCloseFile)
+		{
+			emptyFile(firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			parser.closeFile();
+
+			Assert::IsFalse(parser.hasOpenedFile());
+		}
+
+		TEST_METHOD(testEmptyFileHasReachedItsEnd)
+		{
+			emptyFile(firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			Assert::IsTrue(parser.hasReachedEnd());
+		}
+
+		TEST_METHOD(testReadLineReturnsTheRestOfTheCurrentLine)
+		{
+			writeTextToFile("A line in the file\nAnother line", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			MappedFileParser::Token line = parser.readLine();
+
+			Assert::IsTrue(areEqual("A line in the file", line));
+			Assert::AreEqual('A', parser.peek());
+		}
+
+		TEST_METHOD(testReadLineLeavesOutCarriageReturn)
+		{
+			writeTextToFile("A line in the file\r\n", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			MappedFileParser::Token line = parser.readLine();
+
+			Assert::IsTrue(areEqual("A line in the file", line));
+			Assert::IsTrue(parser.hasReachedEnd());
+		}
+
+		TEST_METHOD(testReadLineOfTheLastLineReachesEnd)
+		{
+			writeTextToFile("The last line", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			MappedFileParser::Token line = parser.readLine();
+
+			Assert::IsTrue(areEqual("The last line", line));
+			Assert::IsTrue(parser.hasReachedEnd());
+		}
+
+		TEST_METHOD(testReadLineWhenNoCharactersAreLeftInTheLine)
+		{
+			writeTextToFile("\n", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			MappedFileParser::Token line = parser.readLine();
+
+			Assert::IsTrue(areEqual("", line));
+		}
+
+		TEST_METHOD(testTokenToStringCopiesItsCharacters)
+		{
+			writeTextToFile("word\n", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			String word = parser.readLine().toString();
+
+			Assert::IsTrue(areEqual("word", word.cString()));
+		}
+
+		TEST_METHOD(testParseUnsignedSkipsWhitespaceAndExtractsNumber)
+		{
+			writeTextToFile(" \r\n  8 ", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			unsigned number = parser.parseUnsigned();
+
+			Assert::AreEqual(8u, number);
+			Assert::AreEqual(' ', parser.peek());
+		}
+
+		TEST_METHOD(testParseUnsignedWithLargestNumber)
+		{
+			writeTextToFile("4294967295", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			unsigned number = parser.parseUnsigned();
+
+			Assert::AreEqual(4294967295u, number);
+		}
+
+		TEST_METHOD(testParseUnsignedWithTooLargeNumber)
+		{
+			writeTextToFile("4294967296", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			try
+			{
+				parser.parseUnsigned();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (FileParserException& ex)
+			{
+				Assert::IsTrue(areEqual("Invalid number format! Error at line 1",
+										ex.what()));
+			}
+		}
+
+		TEST_METHOD(testParseUnsignedWithInvalidNumber)
+		{
+			writeTextToFile("not a number", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			try
+			{
+				parser.parseUnsigned();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (FileParserException& ex)
+			{
+				Assert::IsTrue(areEqual("Invalid number format! Error at line 1",
+										ex.what()));
+			}
+		}
+
+		TEST_METHOD(testParseUnsignedWithNegativeNumber)
+		{
+			writeTextToFile("-128", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			try
+			{
+				parser.parseUnsigned();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (FileParserException& e)
+			{
+				Assert::IsTrue(areEqual("Number must not be negative! Error at line 1",
+										e.what()));
+			}
+		}
+
+		TEST_METHOD(testParseUnsignedWhenNoCharactersAreLeftInFile)
+		{
+			emptyFile(firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			try
+			{
+				parser.parseUnsigned();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (FileParserException& ex)
+			{
+				Assert::IsTrue(areEqual("End of file already reached!",
+										ex.what()));
+			}
+		}
+
+		TEST_METHOD(testSkipUntilStopsAfterThePassedSymbol)
+		{
+			writeTextToFile("skip *@", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			parser.skipUntil('*');
+
+			Assert::AreEqual('@', parser.peek());
+		}
+
+		TEST_METHOD(testSkipUntilWithNoMatchingSymbolSkipsTheWholeFile)
+		{
+			writeTextToFile("the symbol is not here", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			parser.skipUntil('@');
+
+			Assert::IsTrue(parser.hasReachedEnd());
+		}
+
+		TEST_METHOD(testSkipUntilCountsTheLinesItSkips)
+		{
+			writeTextToFile("first\nsecond\n*third", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+			parser.skipUntil('*');
+
+			try
+			{
+				parser.parseUnsigned();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (FileParserException& ex)
+			{
+				Assert::IsTrue(areEqual("Invalid number format! Error at line 3",
+										ex.what()));
+			}
+		}
+
+		TEST_METHOD(testSkipUntilAtEndOfFileDoesNothing)
+		{
+			writeTextToFile("*", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+			parser.skipUntil('*');
+
+			parser.skipUntil('\n');
+
+			Assert::IsTrue(parser.hasReachedEnd());
+		}
+
+		TEST_METHOD(testLastLineWithNoTrailingNewLineIsParsed)
+		{
+			writeTextToFile("(0, 1, 5)", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			parser.skipUntil('(');
+			unsigned start = parser.parseUnsigned();
+			parser.skipUntil(',');
+			unsigned end = parser.parseUnsigned();
+			parser.skipUntil(',');
+			unsigned weight = parser.parseUnsigned();
+			parser.skipUntil(')');
+			parser.skipUntil('\n');
+
+			Assert::AreEqual(0u, start);
+			Assert::AreEqual(1u, end);
+			Assert::AreEqual(5u, weight);
+			Assert::IsTrue(parser.hasReachedEnd());
+		}
+
+		TEST_METHOD(testSkipSpaces)
+		{
+			writeTextToFile("   @", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			parser.skipSpaces();
+
+			Assert::AreEqual('@', parser.peek());
+		}
+
+		TEST_METHOD(testSkipSpacesStopsAtEndOfFile)
+		{
+			writeTextToFile("   ", firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			parser.skipSpaces();
+
+			Assert::IsTrue(parser.hasReachedEnd());
+		}
+
+		TEST_METHOD(testFileOperationsWhenNoFileIsOpenedThrowException)
+		{
+			MappedFileParser parser;
+
+			try
+			{
+				parser.readLine();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (FileParserException& e)
+			{
+				Assert::IsTrue(areEqual("No file is currently opened!",
+										e.what()));
+			}
+		}
+
+		TEST_METHOD(testFileOperationsWhenEndOfFileIsReachedThrowException)
+		{
+			emptyFile(firstTestFileName);
+			MappedFileParser parser(firstTestFileName);
+
+			try
+			{
+				parser.readLine();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (FileParserException& e)
+			{
+				Assert::IsTrue(areEqual("End of file already reached!",
+										e.what()));
+			}
+		}
+
+		TEST_METHOD(testFileOperationsAfterAFailedOperationThrowException)
+		{
+			MappedFileParser parser = parserAfterAFailedOperation();
+
+			try
+			{
+				parser.readLine();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (FileParserException& e)
+			{
+				Assert::IsTrue(areEqual("A previous operation already failed!",
+										e.what()));
+			}
+		}
+
+	};
+
+	const String MappedFileParserTest::firstTestFileName = "testFileOne.txt";
+	const String MappedFileParserTest::secondTestFileName = "testFileTwo.txt";
+	const String MappedFileParserTest::nonExistentFileName = "noSuchFile";
+}
\ No newline at end of file
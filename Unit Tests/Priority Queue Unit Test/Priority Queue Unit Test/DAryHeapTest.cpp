@@ -0,0 +1,212 @@
+#include "CppUnitTest.h"
+#include <random>
+#include "../../../Graph Store/Graph Store/Priority Queue/PriorityQueue.h"
+#include "../../../Graph Store/Graph Store/Dynamic Array/DynamicArray.h"
+#include "HandleUpdator.h"
+#include "KeyAccessor.h"
+#include "Item.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace PriorityQueueUnitTest
+{
+	TEST_CLASS(DAryHeapTest)
+	{
+		typedef PriorityQueue<Item*, Less, unsigned, KeyAccessor, HandleUpdator, 4> QuaternaryQueue;
+		typedef PriorityQueue<Item*, Less, unsigned, KeyAccessor, HandleUpdator, 8> OctonaryQueue;
+		typedef DynamicArray<Item*>::ConstIterator ConstIterator;
+
+		static const size_t ITEMS_COUNT = 100;
+		static DynamicArray<Item> items;
+
+		static DynamicArray<Item*> createReversedArrayOfItems()
+		{
+			DynamicArray<Item*> itemsReversed(ITEMS_COUNT);
+
+			for (int i = ITEMS_COUNT - 1; i >= 0; --i)
+			{
+				itemsReversed.add(&items[i]);
+			}
+
+			return itemsReversed;
+		}
+
+		template <class Queue>
+		static bool queueConsistsOfAllItems(Queue& queue)
+		{
+			for (size_t i = 0; i < ITEMS_COUNT; ++i)
+			{
+				if (queue.isEmpty() || queue.extractOptimal() != &items[i])
+				{
+					return false;
+				}
+			}
+
+			return queue.isEmpty();
+		}
+
+		template <class Queue>
+		static void fillQueueWithAllItems(Queue& queue)
+		{
+			for (size_t i = ITEMS_COUNT / 2; i < ITEMS_COUNT; ++i)
+			{
+				queue.add(&items[i]);
+			}
+
+			for (size_t i = 0; i < ITEMS_COUNT / 2; ++i)
+			{
+				queue.add(&items[i]);
+			}
+		}
+
+		template <class Queue>
+		static bool ctorFromIteratorBuildsAHeap()
+		{
+			DynamicArray<Item*> itemsReversed = createReversedArrayOfItems();
+			ConstIterator iterator = itemsReversed.getConstIterator();
+
+			Queue queue(iterator, itemsReversed.getCount());
+
+			return queueConsistsOfAllItems(queue);
+		}
+
+		template <class Queue>
+		static bool addMaintainsOrderOfPriority()
+		{
+			Queue queue;
+			fillQueueWithAllItems(queue);
+
+			return queueConsistsOfAllItems(queue);
+		}
+
+		template <class Queue>
+		static bool optimiseKeyMovesTheItemToTheTop()
+		{
+			Queue queue;
+			fillQueueWithAllItems(queue);
+			queue.extractOptimal();
+			Item& itemWithNonOptimalKey = items[ITEMS_COUNT - 1];
+
+			queue.optimiseKey(itemWithNonOptimalKey.handle, 0);
+
+			return queue.getOptimal() == &itemWithNonOptimalKey;
+		}
+
+		template <class Queue>
+		static bool randomOptimisationsKeepTheOrderOfPriority()
+		{
+			const size_t count = 1000;
+			DynamicArray<Item> randomItems(count, count);
+			DynamicArray<bool> isInQueue(count, count);
+			Queue queue;
+			std::mt19937 generator(13);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				randomItems[i] = Item(1000 + generator() % 100000);
+				queue.add(&randomItems[i]);
+				isInQueue[i] = true;
+			}
+
+			for (size_t i = 0; i < 4 * count; ++i)
+			{
+				if (i % 8 == 0 && !queue.isEmpty())
+				{
+					isInQueue[queue.extractOptimal() - &randomItems[0]] = false;
+				}
+
+				size_t index = generator() % count;
+				Item& item = randomItems[index];
+
+				if (isInQueue[index] && item.key > 0)
+				{
+					queue.optimiseKey(item.handle, generator() % item.key);
+				}
+			}
+
+			unsigned lastKey = 0;
+
+			while (!queue.isEmpty())
+			{
+				Item* item = queue.extractOptimal();
+
+				if (item->key < lastKey)
+				{
+					return false;
+				}
+
+				lastKey = item->key;
+			}
+
+			return true;
+		}
+
+	public:
+		TEST_METHOD_INITIALIZE(initialiseItems)
+		{
+			for (size_t i = 0; i < ITEMS_COUNT; ++i)
+			{
+				items[i] = Item(i);
+			}
+		}
+
+		TEST_METHOD(testCtorFromIteratorBuildsAQuaternaryHeap)
+		{
+			Assert::IsTrue(ctorFromIteratorBuildsAHeap<QuaternaryQueue>());
+		}
+
+		TEST_METHOD(testCtorFromIteratorBuildsAnOctonaryHeap)
+		{
+			Assert::IsTrue(ctorFromIteratorBuildsAHeap<OctonaryQueue>());
+		}
+
+		TEST_METHOD(testAddMaintainsOrderOfPriorityInQuaternaryHeap)
+		{
+			Assert::IsTrue(addMaintainsOrderOfPriority<QuaternaryQueue>());
+		}
+
+		TEST_METHOD(testAddMaintainsOrderOfPriorityInOctonaryHeap)
+		{
+			Assert::IsTrue(addMaintainsOrderOfPriority<OctonaryQueue>());
+		}
+
+		TEST_METHOD(testOptimiseKeyInQuaternaryHeap)
+		{
+			Assert::IsTrue(optimiseKeyMovesTheItemToTheTop<QuaternaryQueue>());
+		}
+
+		TEST_METHOD(testOptimiseKeyInOctonaryHeap)
+		{
+			Assert::IsTrue(optimiseKeyMovesTheItemToTheTop<OctonaryQueue>());
+		}
+
+		TEST_METHOD(testRandomOptimisationsInQuaternaryHeap)
+		{
+			Assert::IsTrue(randomOptimisationsKeepTheOrderOfPriority<QuaternaryQueue>());
+		}
+
+		TEST_METHOD(testRandomOptimisationsInOctonaryHeap)
+		{
+			Assert::IsTrue(randomOptimisationsKeepTheOrderOfPriority<OctonaryQueue>());
+		}
+
+		TEST_METHOD(testOptimiseKeyWithWorseKeyThrowsException)
+		{
+			QuaternaryQueue queue;
+			queue.add(&items[0]);
+
+			try
+			{
+				queue.optimiseKey(items[0].handle, 1);
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (std::invalid_argument& e)
+			{
+				Assert::IsTrue(strcmp("The key can't be worsened!", e.what()) == 0);
+			}
+		}
+
+	};
+
+	DynamicArray<Item> DAryHeapTest::items(ITEMS_COUNT, ITEMS_COUNT);
+}
\ No newline at end of file
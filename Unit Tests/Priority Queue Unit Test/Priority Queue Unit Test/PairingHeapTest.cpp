@@ -0,0 +1,343 @@
+#include "CppUnitTest.h"
+#include <utility>
+#include <random>
+#include "../../../Graph Store/Graph Store/Priority Queue/Pairing Heap/PairingHeap.h"
+#include "../../../Graph Store/Graph Store/Dynamic Array/DynamicArray.h"
+#include "HandleUpdator.h"
+#include "KeyAccessor.h"
+#include "Item.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace PriorityQueueUnitTest
+{
+	TEST_CLASS(PairingHeapTest)
+	{
+		typedef PairingHeap<Item*, Less, unsigned, KeyAccessor, HandleUpdator> PairingHeap;
+		typedef DynamicArray<Item*>::ConstIterator ConstIterator;
+
+		static const size_t ARRAY_SIZE = 8;
+		static DynamicArray<Item> items;
+
+		static DynamicArray<Item*> createReversedArrayOfItems()
+		{
+			DynamicArray<Item*> itemsReversed(ARRAY_SIZE);
+
+			for (int i = ARRAY_SIZE - 1; i >= 0; --i)
+			{
+				itemsReversed.add(&items[i]);
+			}
+
+			return itemsReversed;
+		}
+
+		static bool heapConsistsOfItemsInRange(PairingHeap& heap,
+											   unsigned firstNumber,
+											   unsigned lastNumber)
+		{
+			assert(isValidRange(firstNumber, lastNumber));
+			Item* item;
+
+			for (unsigned i = firstNumber; i <= lastNumber; ++i)
+			{
+				assert(!heap.isEmpty());
+				item = heap.extractOptimal();
+
+				if (item != &items[i])
+				{
+					return false;
+				}
+			}
+
+			return heap.isEmpty();
+		}
+
+		static PairingHeap createHeapFromItemsInRange(unsigned firstNumber,
+													  unsigned lastNumber)
+		{
+			PairingHeap heap;
+			fillHeapWithItemsInRange(heap, firstNumber, lastNumber);
+
+			return heap;
+		}
+
+		static void fillHeapWithItemsInRange(PairingHeap& heap,
+											 unsigned firstNumber,
+											 unsigned lastNumber)
+		{
+			assert(isValidRange(firstNumber, lastNumber));
+
+			for (unsigned i = firstNumber; i <= lastNumber; ++i)
+			{
+				heap.add(&items[i]);
+			}
+		}
+
+		static bool isValidRange(unsigned firstNumber, unsigned lastNumber)
+		{
+			return firstNumber <= lastNumber && lastNumber < ARRAY_SIZE;
+		}
+
+		static bool areEqual(const char* lhs, const char* rhs)
+		{
+			return strcmp(lhs, rhs) == 0;
+		}
+
+	public:
+		TEST_METHOD_INITIALIZE(initialiseItems)
+		{
+			for (size_t i = 0; i < ARRAY_SIZE; ++i)
+			{
+				items[i] = Item(i);
+			}
+		}
+
+		TEST_METHOD(testDefaultCtorCreatesAnEmptyHeap)
+		{
+			PairingHeap heap;
+
+			Assert::IsTrue(heap.isEmpty());
+		}
+
+		TEST_METHOD(testCtorFromIteratorAndCountInsertsFirstCountElements)
+		{
+			DynamicArray<Item*> itemsReversed = createReversedArrayOfItems();
+			ConstIterator iterator = itemsReversed.getConstIterator();
+
+			PairingHeap heap(iterator, itemsReversed.getCount());
+
+			Assert::IsTrue(heapConsistsOfItemsInRange(heap, 0, ARRAY_SIZE - 1));
+		}
+
+		TEST_METHOD(testCopyCtorFromNonEmptyHeap)
+		{
+			PairingHeap heapToCopy = createHeapFromItemsInRange(0, ARRAY_SIZE / 2);
+
+			PairingHeap heap(heapToCopy);
+
+			Assert::IsTrue(heapConsistsOfItemsInRange(heap, 0, ARRAY_SIZE / 2));
+		}
+
+		TEST_METHOD(testCopyAssignmentNonEmptyToNonEmptyHeap)
+		{
+			PairingHeap heapToCopy =
+				createHeapFromItemsInRange(0, ARRAY_SIZE / 2);
+			PairingHeap heap =
+				createHeapFromItemsInRange((ARRAY_SIZE / 2) + 1, ARRAY_SIZE - 1);
+
+			heap = heapToCopy;
+
+			Assert::IsTrue(heapConsistsOfItemsInRange(heap, 0, ARRAY_SIZE / 2));
+		}
+
+		TEST_METHOD(testMoveCtorFromNonEmptyHeap)
+		{
+			PairingHeap heapToMove;
+			fillHeapWithItemsInRange(heapToMove, 0, ARRAY_SIZE / 2);
+
+			PairingHeap heap(std::move(heapToMove));
+
+			Assert::IsTrue(heapToMove.isEmpty(), L"The moved-from heap did not become empty!");
+			Assert::IsTrue(heapConsistsOfItemsInRange(heap, 0, ARRAY_SIZE / 2));
+		}
+
+		TEST_METHOD(testMoveAssignmentEmptyToNonEmptyHeap)
+		{
+			PairingHeap heapToMove;
+			PairingHeap heap = createHeapFromItemsInRange(0, ARRAY_SIZE / 2);
+
+			heap = std::move(heapToMove);
+
+			Assert::IsTrue(heap.isEmpty(), L"The moved-into heap did not become empty!");
+			Assert::IsTrue(heapToMove.isEmpty());
+		}
+
+		TEST_METHOD(testMoveAssignmentNonEmptyToNonEmptyHeap)
+		{
+			PairingHeap heapToMove =
+				createHeapFromItemsInRange(0, ARRAY_SIZE / 2);
+			PairingHeap heap =
+				createHeapFromItemsInRange((ARRAY_SIZE / 2) + 1, ARRAY_SIZE - 1);
+
+			heap = std::move(heapToMove);
+
+			Assert::IsTrue(heapToMove.isEmpty(), L"The moved-from heap did not become empty!");
+			Assert::IsTrue(heapConsistsOfItemsInRange(heap, 0, ARRAY_SIZE / 2));
+		}
+
+		TEST_METHOD(testAddMaintainsOrderOfPriority)
+		{
+			PairingHeap heap;
+			size_t middle = ARRAY_SIZE / 2;
+
+			fillHeapWithItemsInRange(heap, middle, ARRAY_SIZE - 1);
+			fillHeapWithItemsInRange(heap, 0, middle - 1);
+
+			Assert::IsTrue(heap.getOptimal() == &items[0]);
+		}
+
+		TEST_METHOD(testExtractOptimalMaintainsOrderOfPriority)
+		{
+			PairingHeap heap = createHeapFromItemsInRange(0, ARRAY_SIZE / 2);
+
+			Item* optimalItem = heap.extractOptimal();
+
+			Assert::IsTrue(optimalItem == &items[0], L"The method did not extract the item with optimal key!");
+			Assert::IsTrue(heap.getOptimal() == &items[1]);
+		}
+
+		TEST_METHOD(testExtractOptimalInvalidatesTheHandleOfTheItem)
+		{
+			PairingHeap heap = createHeapFromItemsInRange(0, ARRAY_SIZE / 2);
+
+			heap.extractOptimal();
+
+			try
+			{
+				heap.optimiseKey(items[0].handle, 0);
+				Assert::Fail(L"The handle of the extracted item is still valid!");
+			}
+			catch (std::invalid_argument& e)
+			{
+				Assert::IsTrue(areEqual("Invalid handle!", e.what()));
+			}
+		}
+
+		TEST_METHOD(testExtractOptimalFromEmptyHeapThrowsException)
+		{
+			PairingHeap heap;
+
+			try
+			{
+				heap.extractOptimal();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (std::logic_error& e)
+			{
+				Assert::IsTrue(areEqual("The queue is empty!", e.what()));
+			}
+		}
+
+		TEST_METHOD(testOptimiseKeyWithNewOptimalKeyUpdatesOptimalItem)
+		{
+			PairingHeap heap = createHeapFromItemsInRange(ARRAY_SIZE / 2, ARRAY_SIZE - 1);
+			heap.extractOptimal();
+			Item& itemWithNonOptimalKey = items[ARRAY_SIZE - 1];
+
+			heap.optimiseKey(itemWithNonOptimalKey.handle, 0);
+
+			const Item* optimalItem = heap.getOptimal();
+			Assert::AreEqual(0u, optimalItem->key);
+			Assert::IsTrue(optimalItem == &itemWithNonOptimalKey);
+		}
+
+		TEST_METHOD(testOptimiseKeyOfNonOptimalItemWithNonOptimalKey)
+		{
+			PairingHeap heap = createHeapFromItemsInRange(0, ARRAY_SIZE - 1);
+			heap.extractOptimal();
+			Item& itemWithNonOptimalKey = items[ARRAY_SIZE - 1];
+
+			heap.optimiseKey(itemWithNonOptimalKey.handle, 2);
+
+			Assert::IsTrue(heap.extractOptimal() == &items[1]);
+			Assert::AreEqual(2u, heap.extractOptimal()->key);
+			Assert::AreEqual(2u, heap.extractOptimal()->key);
+			Assert::IsTrue(heap.getOptimal() == &items[3]);
+		}
+
+		TEST_METHOD(testOptimiseKeyWithWorseKeyThrowsException)
+		{
+			PairingHeap heap = createHeapFromItemsInRange(0, 0);
+
+			try
+			{
+				heap.optimiseKey(items[0].handle, 1);
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (std::invalid_argument& e)
+			{
+				Assert::IsTrue(areEqual("The key can't be worsened!", e.what()));
+			}
+		}
+
+		TEST_METHOD(testOptimiseKeyWithInvalidHandleThrowsException)
+		{
+			PairingHeap heap;
+			PriorityQueueHandle invalidHandle;
+
+			try
+			{
+				heap.optimiseKey(invalidHandle, 100);
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (std::invalid_argument& e)
+			{
+				Assert::IsTrue(areEqual("Invalid handle!", e.what()));
+			}
+		}
+
+		TEST_METHOD(testEmptyInvalidatesAllHandles)
+		{
+			PairingHeap heap = createHeapFromItemsInRange(0, ARRAY_SIZE - 1);
+
+			heap.empty();
+
+			Assert::IsTrue(heap.isEmpty());
+
+			try
+			{
+				heap.optimiseKey(items[ARRAY_SIZE - 1].handle, 0);
+				Assert::Fail(L"The handle of a removed item is still valid!");
+			}
+			catch (std::invalid_argument& e)
+			{
+				Assert::IsTrue(areEqual("Invalid handle!", e.what()));
+			}
+		}
+
+		TEST_METHOD(testRandomOptimisationsKeepTheOrderOfPriority)
+		{
+			const size_t count = 1000;
+			DynamicArray<Item> randomItems(count, count);
+			DynamicArray<bool> isInHeap(count, count);
+			PairingHeap heap;
+			std::mt19937 generator(13);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				randomItems[i] = Item(1000 + generator() % 100000);
+				heap.add(&randomItems[i]);
+				isInHeap[i] = true;
+			}
+
+			for (size_t i = 0; i < 4 * count; ++i)
+			{
+				if (i % 8 == 0 && !heap.isEmpty())
+				{
+					isInHeap[heap.extractOptimal() - &randomItems[0]] = false;
+				}
+
+				size_t index = generator() % count;
+				Item& item = randomItems[index];
+
+				if (isInHeap[index] && item.key > 0)
+				{
+					heap.optimiseKey(item.handle, generator() % item.key);
+				}
+			}
+
+			unsigned lastKey = 0;
+
+			while (!heap.isEmpty())
+			{
+				Item* item = heap.extractOptimal();
+
+				Assert::IsTrue(lastKey <= item->key);
+				lastKey = item->key;
+			}
+		}
+
+	};
+
+	DynamicArray<Item> PairingHeapTest::items(ARRAY_SIZE, ARRAY_SIZE);
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../../../Graph Store/Graph Store/Radix Heap/RadixHeap.h"
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace RadixHeapUnitTest
+{
+	TEST_CLASS(RadixHeapTest)
+	{
+		typedef RadixHeap<int> Queue;
+
+	public:
+		TEST_METHOD(testNewRadixHeapIsEmpty)
+		{
+			Queue queue;
+
+			Assert::IsTrue(queue.isEmpty());
+		}
+
+		TEST_METHOD(testExtractFromEmptyRadixHeapThrowsException)
+		{
+			Queue queue;
+
+			try
+			{
+				queue.extractOptimal();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (std::logic_error&)
+			{
+			}
+		}
+
+		TEST_METHOD(testItemsAreExtractedInTheOrderOfTheirKeys)
+		{
+			Queue queue;
+			unsigned keys[] = { 7, 3, 12, 0, 3, 9, 1 };
+
+			for (unsigned key : keys)
+			{
+				queue.add(static_cast<int>(key), key);
+			}
+
+			std::sort(std::begin(keys), std::end(keys));
+
+			for (unsigned key : keys)
+			{
+				Assert::AreEqual(key, queue.getOptimalKey());
+				Assert::AreEqual(static_cast<int>(key), queue.extractOptimal());
+			}
+
+			Assert::IsTrue(queue.isEmpty());
+		}
+
+		TEST_METHOD(testRedistributedBucketSpreadsOverTheLowerOnes)
+		{
+			Queue queue;
+			std::vector<unsigned> keys;
+
+			for (unsigned key = 64; key < 128; ++key)
+			{
+				keys.push_back(key);
+			}
+
+			std::shuffle(keys.begin(), keys.end(), std::mt19937(5));
+
+			for (unsigned key : keys)
+			{
+				queue.add(static_cast<int>(key), key);
+			}
+
+			for (unsigned key = 64; key < 128; ++key)
+			{
+				Assert::AreEqual(key, queue.getOptimalKey());
+				Assert::AreEqual(static_cast<int>(key), queue.extractOptimal());
+			}
+
+			Assert::IsTrue(queue.isEmpty());
+		}
+
+		TEST_METHOD(testKeysAddedAfterRedistributionAreOrderedWithTheMovedOnes)
+		{
+			Queue queue;
+			queue.add(1, 100);
+			queue.add(2, 130);
+			queue.add(3, 200);
+
+			Assert::AreEqual(1, queue.extractOptimal());
+
+			queue.add(4, 100);
+			queue.add(5, 127);
+			queue.add(6, 131);
+
+			Assert::AreEqual(4, queue.extractOptimal());
+			Assert::AreEqual(5, queue.extractOptimal());
+			Assert::AreEqual(2, queue.extractOptimal());
+			Assert::AreEqual(6, queue.extractOptimal());
+			Assert::AreEqual(3, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testKeyBelowPendingKeysButNotBelowTheLastExtractedOneIsAccepted)
+		{
+			Queue queue;
+			queue.add(1, 10);
+			queue.add(2, 1000);
+			queue.extractOptimal();
+
+			queue.add(3, 11);
+
+			Assert::AreEqual(3, queue.extractOptimal());
+			Assert::AreEqual(2, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testKeysDifferingInTheHighestBitAreExtractedInOrder)
+		{
+			Queue queue;
+			queue.add(3, UINT_MAX);
+			queue.add(1, 0);
+			queue.add(2, UINT_MAX - 1);
+
+			Assert::AreEqual(1, queue.extractOptimal());
+			Assert::AreEqual(2, queue.extractOptimal());
+			Assert::AreEqual(UINT_MAX, queue.getOptimalKey());
+			Assert::AreEqual(3, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testAddingKeyBelowTheLastExtractedOneThrowsException)
+		{
+			Queue queue;
+			queue.add(1, 10);
+			queue.extractOptimal();
+
+			try
+			{
+				queue.add(2, 9);
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (std::invalid_argument&)
+			{
+			}
+		}
+
+		TEST_METHOD(testKeyEqualToTheLastExtractedOneIsAccepted)
+		{
+			Queue queue;
+			queue.add(1, 10);
+			queue.extractOptimal();
+			queue.add(2, 10);
+
+			Assert::AreEqual(2, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testEmptyRemovesAllItemsAndResetsTheKeys)
+		{
+			Queue queue;
+			queue.add(1, 5);
+			queue.add(2, 8);
+			queue.extractOptimal();
+
+			queue.empty();
+
+			Assert::IsTrue(queue.isEmpty());
+
+			queue.add(3, 0);
+
+			Assert::AreEqual(3, queue.extractOptimal());
+		}
+
+		TEST_METHOD(testMonotoneSequenceWithWideKeyDifferencesMatchesSorting)
+		{
+			Queue queue;
+			std::vector<unsigned> pendingKeys;
+			std::mt19937 generator(17);
+			unsigned lastKey = 0;
+
+			for (int i = 0; i < 10000; ++i)
+			{
+				if (pendingKeys.empty() || generator() % 3 != 0)
+				{
+					unsigned key = lastKey + (generator() >> (generator() % 32)) % 1000000;
+					pendingKeys.push_back(key);
+					queue.add(static_cast<int>(key), key);
+				}
+				else
+				{
+					std::vector<unsigned>::iterator minimum = std::min_element(pendingKeys.begin(), pendingKeys.end());
+
+					lastKey = *minimum;
+					Assert::AreEqual(static_cast<int>(lastKey), queue.extractOptimal());
+
+					*minimum = pendingKeys.back();
+					pendingKeys.pop_back();
+				}
+			}
+		}
+	};
+}
\ No newline at end of file
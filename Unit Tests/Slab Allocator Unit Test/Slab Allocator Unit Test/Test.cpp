@@ -0,0 +1,160 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../../../Graph Store/Graph Store/Slab Allocator/SlabAllocator.h"
+#include <set>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SlabAllocatorUnitTest
+{
+	TEST_CLASS(SlabAllocatorTest)
+	{
+		struct Item
+		{
+			Item(int number) :
+				number(number)
+			{
+			}
+
+			int number;
+			double padding;
+		};
+
+		typedef SlabAllocator<Item> Allocator;
+
+	public:
+		TEST_METHOD(testConstructorWithZeroSlabSizeThrowsException)
+		{
+			try
+			{
+				Allocator allocator(0);
+				Assert::Fail(L"The constructor did not throw an exception!");
+			}
+			catch (std::invalid_argument&)
+			{
+			}
+		}
+
+		TEST_METHOD(testNewAllocatorHasNoSlabs)
+		{
+			Allocator allocator;
+
+			Assert::AreEqual(size_t(0), allocator.getSlabsCount());
+		}
+
+		TEST_METHOD(testAllocateReturnsDistinctAlignedSlots)
+		{
+			Allocator allocator(4);
+			std::set<Item*> slots;
+
+			for (int i = 0; i < 100; ++i)
+			{
+				Item* slot = allocator.allocate();
+
+				Assert::IsTrue(reinterpret_cast<size_t>(slot) % alignof(Item) == 0);
+				Assert::IsTrue(slots.insert(slot).second);
+			}
+		}
+
+		TEST_METHOD(testObjectsInSlotsKeepTheirValues)
+		{
+			Allocator allocator(2);
+			Item* items[10];
+
+			for (int i = 0; i < 10; ++i)
+			{
+				items[i] = new (allocator.allocate()) Item(i);
+			}
+
+			for (int i = 0; i < 10; ++i)
+			{
+				Assert::AreEqual(i, items[i]->number);
+			}
+		}
+
+		TEST_METHOD(testReleasedSlotIsReused)
+		{
+			Allocator allocator;
+			allocator.allocate();
+			Item* released = allocator.allocate();
+
+			allocator.release(released);
+
+			Assert::IsTrue(allocator.allocate() == released);
+		}
+
+		TEST_METHOD(testReleasedSlotsDoNotRequireNewSlabs)
+		{
+			Allocator allocator(4);
+			Item* items[4];
+
+			for (int i = 0; i < 4; ++i)
+			{
+				items[i] = allocator.allocate();
+			}
+
+			for (int i = 0; i < 4; ++i)
+			{
+				allocator.release(items[i]);
+			}
+
+			for (int i = 0; i < 4; ++i)
+			{
+				allocator.allocate();
+			}
+
+			Assert::AreEqual(size_t(1), allocator.getSlabsCount());
+		}
+
+		TEST_METHOD(testSlabsGrowGeometrically)
+		{
+			Allocator allocator(1);
+
+			for (int i = 0; i < 7; ++i)
+			{
+				allocator.allocate();
+			}
+
+			Assert::AreEqual(size_t(3), allocator.getSlabsCount());
+		}
+
+		TEST_METHOD(testReservedSlotsDoNotRequireNewSlabs)
+		{
+			Allocator allocator(4);
+
+			allocator.reserve(1000);
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				allocator.allocate();
+			}
+
+			Assert::AreEqual(size_t(1), allocator.getSlabsCount());
+		}
+
+		TEST_METHOD(testReserveUsesTheUnusedSlotsOfTheCurrentSlab)
+		{
+			Allocator allocator(4);
+			allocator.allocate();
+
+			allocator.reserve(100);
+
+			for (int i = 0; i < 100; ++i)
+			{
+				allocator.allocate();
+			}
+
+			Assert::AreEqual(size_t(2), allocator.getSlabsCount());
+		}
+
+		TEST_METHOD(testReserveWithinTheCurrentSlabAddsNoSlab)
+		{
+			Allocator allocator(4);
+			allocator.allocate();
+
+			allocator.reserve(3);
+
+			Assert::AreEqual(size_t(1), allocator.getSlabsCount());
+		}
+	};
+}
\ No newline at end of file
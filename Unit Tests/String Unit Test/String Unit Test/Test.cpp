@@ -49,6 +49,21 @@ namespace StringUnitTest
 			Assert::IsTrue(areEqual("", string));
 		}
 
+		TEST_METHOD(testConstructorFromCharactersCopiesOnlyTheGivenLength)
+		{
+			const char characters[] = { 'w', 'o', 'r', 'd', '!' };
+			String string(characters, 4);
+
+			Assert::IsTrue(areEqual("word", string));
+		}
+
+		TEST_METHOD(testConstructorFromNoCharactersCreatesAnEmptyString)
+		{
+			String string("word", 0);
+
+			Assert::IsTrue(areEqual("", string));
+		}
+
 		TEST_METHOD(testMoveConstructorFromEmptyString)
 		{
 			String emptyString = "";